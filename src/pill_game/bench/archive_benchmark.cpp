@@ -0,0 +1,130 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/bench/archive_benchmark.h"
+
+#include "pill_game/game/game_session.h"
+
+namespace pill_game::bench {
+
+namespace {
+
+using game::ArchiveEntry;
+using game::GameSession;
+using game::ReplayArchive;
+using game::ReplayInputStream;
+using game::TickInput;
+using Clock = std::chrono::steady_clock;
+
+double elapsed_us(Clock::duration elapsed) noexcept {
+    return std::chrono::duration<double, std::micro>(elapsed).count();
+}
+
+}  // namespace
+
+int run_archive_import(const fs::path& directory, const fs::path& archive) noexcept {
+    try {
+        game::ReplayArchiveWriter writer{archive};
+        uint64_t skipped{0};
+
+        for (const auto& entry : fs::directory_iterator{directory}) {
+            if (!entry.is_regular_file() || entry.path().extension() != game::REPLAY_EXTENSION) {
+                continue;
+            }
+
+            try {
+                writer.append(game::load_replay(entry.path()));
+            } catch (const std::exception& ex) {
+                PG_LOG(Warn, "skipping replay - {}", ex.what());
+                ++skipped;
+            }
+        }
+
+        const uint64_t imported = writer.count();
+        writer.finish();
+        PG_LOG(
+            Info,
+            "archived {} replays ({} skipped), {} now {} bytes",
+            imported,
+            skipped,
+            archive.string(),
+            fs::file_size(archive)
+        );
+        return 0;
+
+    } catch (const std::exception& ex) {
+        PG_LOG(Err, "archive import failed - {}", ex.what());
+        return -1;
+    }
+}
+
+int run_archive_query(
+    const fs::path& archive,
+    uint8_t level,
+    game::ReplayOutcome outcome,
+    uint32_t max_seconds
+) noexcept {
+    try {
+        const auto open_start = Clock::now();
+        const ReplayArchive replays{archive};
+        const auto open_elapsed = Clock::now() - open_start;
+
+        const auto query_start = Clock::now();
+        const std::span<const ArchiveEntry> matches = replays.query(level, outcome, max_seconds * game::SIM_TICK_RATE);
+        const auto query_elapsed = Clock::now() - query_start;
+
+        PG_LOG(
+            Info,
+            "{} of {} replays are level {} {} under {} s (open {:.1f} us, query {:.1f} us)",
+            matches.size(),
+            replays.entries().size(),
+            level,
+            outcome == game::ReplayOutcome::Won ? "wins" : "losses",
+            max_seconds,
+            elapsed_us(open_elapsed),
+            elapsed_us(query_elapsed)
+        );
+
+        // re-simulate from the mapped bytes; no replay is ever copied out
+        uint64_t ticks{0};
+        uint32_t desyncs{0};
+        auto session = std::make_unique<GameSession>();
+        const auto sim_start = Clock::now();
+        for (const ArchiveEntry& entry : matches) {
+            const game::ReplayHeader header = replays.header(entry);
+            game::start_replay_session(header, *session);
+
+            ReplayInputStream stream = replays.inputs(entry);
+            TickInput input{};
+            while (stream.next(input)) {
+                session->tick(input);
+                ++ticks;
+            }
+
+            if (session->Board.enemy_count() != header.FinalEnemyCount) {
+                PG_LOG(Warn, "replay with seed {} did not reproduce its recorded result", entry.Seed);
+                ++desyncs;
+            }
+        }
+        const auto seconds = std::chrono::duration<double>(Clock::now() - sim_start).count();
+
+        PG_LOG(
+            Info,
+            "re-simulated {} ticks at {:.0f} ticks/s, {} desynced",
+            ticks,
+            seconds > 0.0 ? static_cast<double>(ticks) / seconds : 0.0,
+            desyncs
+        );
+        return desyncs == 0 ? 0 : 1;
+
+    } catch (const std::exception& ex) {
+        PG_LOG(Err, "archive query failed - {}", ex.what());
+        return -1;
+    }
+}
+
+}  // namespace pill_game::bench
@@ -0,0 +1,30 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+#include "pill_game/game/replay_archive.h"
+
+namespace pill_game::bench {
+
+// Appends every replay in 'directory' to 'archive' and indexes it
+int run_archive_import(const fs::path& directory, const fs::path& archive) noexcept;
+
+//
+// Finds the 'outcome' games at 'level' lasting at most 'max_seconds' using
+// only the mapped index, then re-simulates each one straight from the
+// archive and checks it reproduces its recorded result.
+//
+int run_archive_query(
+    const fs::path& archive,
+    uint8_t level,
+    game::ReplayOutcome outcome,
+    uint32_t max_seconds
+) noexcept;
+
+}  // namespace pill_game::bench
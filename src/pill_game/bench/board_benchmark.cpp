@@ -0,0 +1,147 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/bench/board_benchmark.h"
+
+#include "pill_game/game/board.h"
+
+namespace pill_game::bench {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// clang-format off
+constexpr uint8_t  MAX_LEVEL   = 20;
+constexpr uint32_t PARAM_COUNT = MAX_LEVEL * 4;  // every level with and without pills/blocks
+// clang-format on
+
+struct BoardResult {
+    uint64_t Checksum{0};
+    uint64_t Enemies{0};
+};
+
+std::vector<BoardInitParams> all_params() {
+    std::vector<BoardInitParams> params{};
+    params.reserve(PARAM_COUNT);
+    for (uint8_t level = 1; level <= MAX_LEVEL; ++level) {
+        for (uint32_t options = 0; options < 4; ++options) {
+            params.push_back(BoardInitParams::create_difficulty(level, (options & 1U) != 0, (options & 2U) != 0));
+        }
+    }
+    return params;
+}
+
+uint64_t board_hash(const PillGameBoard& board) noexcept {
+    uint64_t hash{0xCBF29CE484222325ULL};
+    for (const BoardEntity& entity : board.flat_game_board()) {
+        hash = (hash ^ std::bit_cast<uint8_t>(entity)) * 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+// Boards [first, last); board i is generated from seed i with params i % PARAM_COUNT
+BoardResult generate(const std::vector<BoardInitParams>& params, uint32_t first, uint32_t last) noexcept {
+    BoardResult result{};
+    PillGameBoard board{};
+    for (uint32_t i = first; i < last; ++i) {
+        board.init_board(params[i % PARAM_COUNT], i);
+        result.Checksum += board_hash(board);
+        result.Enemies += board.enemy_count();
+    }
+    return result;
+}
+
+uint32_t count_invalid(const std::vector<BoardInitParams>& params, uint32_t board_count) noexcept {
+    uint32_t invalid{0};
+    PillGameBoard board{};
+    for (uint32_t i = 0; i < board_count; ++i) {
+        const BoardInitParams& init = params[i % PARAM_COUNT];
+        board.init_board(init, i);
+
+        for (uint32_t row = 0; row < GAME_BOARD_HEIGHT; ++row) {
+            for (uint32_t col = 0; col < GAME_BOARD_WIDTH; ++col) {
+                if (!board(row, col).is_empty()
+                    && (board.horizontal_colour_count(row, col) > init.MaxConnectedColours
+                        || board.vertical_colour_count(row, col) > init.MaxConnectedColours)) {
+                    ++invalid;
+                    row = GAME_BOARD_HEIGHT;
+                    break;
+                }
+            }
+        }
+    }
+    return invalid;
+}
+
+double per_second(uint64_t count, Clock::duration elapsed) noexcept {
+    const auto seconds = std::chrono::duration<double>(elapsed).count();
+    return seconds > 0.0 ? static_cast<double>(count) / seconds : 0.0;
+}
+
+}  // namespace
+
+int run_board_benchmark(uint32_t board_count) noexcept {
+    try {
+        const std::vector<BoardInitParams> params = all_params();
+        const uint32_t thread_count = std::max(std::thread::hardware_concurrency(), 1U);
+
+        const auto single_start = Clock::now();
+        const BoardResult single = generate(params, 0, board_count);
+        const auto single_elapsed = Clock::now() - single_start;
+
+        // each thread takes a slice of the seeds; the boards can't depend on who made them
+        std::vector<BoardResult> results(thread_count);
+        std::vector<std::thread> workers{};
+        workers.reserve(thread_count);
+
+        const auto multi_start = Clock::now();
+        for (uint32_t t = 0; t < thread_count; ++t) {
+            const auto first = static_cast<uint32_t>((static_cast<uint64_t>(board_count) * t) / thread_count);
+            const auto last = static_cast<uint32_t>((static_cast<uint64_t>(board_count) * (t + 1)) / thread_count);
+            workers.emplace_back([&params, &result = results.at(t), first, last]() {
+                result = generate(params, first, last);
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        const auto multi_elapsed = Clock::now() - multi_start;
+
+        BoardResult multi{};
+        for (const BoardResult& r : results) {
+            multi.Checksum += r.Checksum;
+            multi.Enemies += r.Enemies;
+        }
+
+        const uint32_t invalid = count_invalid(params, std::min(board_count, 100'000U));
+        const bool matched = single.Checksum == multi.Checksum && single.Enemies == multi.Enemies;
+
+        PG_LOG(
+            Info,
+            "single thread : {:>12.0f} boards/s ({:.0f} ns a board, {:.1f} enemies on average)",
+            per_second(board_count, single_elapsed),
+            std::chrono::duration<double, std::nano>(single_elapsed).count() / std::max(board_count, 1U),
+            static_cast<double>(single.Enemies) / std::max(board_count, 1U)
+        );
+        PG_LOG(Info, "{:>3} threads   : {:>12.0f} boards/s", thread_count, per_second(board_count, multi_elapsed));
+        PG_LOG(
+            Info,
+            "checked       : {} invalid, threaded run {}",
+            invalid,
+            matched ? "identical" : "DIFFERENT"
+        );
+
+        return invalid == 0 && matched ? 0 : 1;
+
+    } catch (const std::exception& ex) {
+        PG_LOG(Err, "board benchmark failed - {}", ex.what());
+        return -1;
+    }
+}
+
+}  // namespace pill_game::bench
@@ -0,0 +1,20 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+namespace pill_game::bench {
+
+//
+// Generates 'board_count' boards spread over every level, on one thread and
+// then on every core, and checks each one keeps within MaxConnectedColours
+// and comes out the same on both runs.
+//
+int run_board_benchmark(uint32_t board_count) noexcept;
+
+}  // namespace pill_game::bench
@@ -0,0 +1,46 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+#include "pill_game/game/game_session.h"
+
+namespace pill_game::bench {
+
+// clang-format off
+
+// A bot presses or releases something on one tick in this many; a power of two
+constexpr uint32_t BOT_INPUT_ODDS = 8;
+
+// Bots only touch the gameplay buttons, Up through B
+constexpr uint32_t BOT_BUTTONS    = static_cast<uint32_t>(game::Button::Start);
+
+// clang-format on
+
+// xorshift32; 'state' must never be 0
+constexpr uint32_t xorshift(uint32_t& state) noexcept {
+    state ^= state << 13U;
+    state ^= state >> 17U;
+    state ^= state << 5U;
+    return state;
+}
+
+//
+// One tick of a bot driven by 'state': now and again presses or releases a
+// random gameplay button. Draws from 'state' every tick, so a bot's inputs
+// depend only on its seed and not on what it was allowed to send.
+//
+constexpr std::optional<game::InputEvent> bot_input(uint32_t& state, uint32_t odds = BOT_INPUT_ODDS) noexcept {
+    const uint32_t r = xorshift(state);
+    if ((r & (odds - 1U)) != 0) {
+        return std::nullopt;
+    }
+    return game::InputEvent{0, static_cast<game::Button>((r >> 8U) % BOT_BUTTONS), ((r >> 16U) & 1U) != 0};
+}
+
+}  // namespace pill_game::bench
@@ -0,0 +1,114 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/bench/corpus_benchmark.h"
+
+#include "pill_game/game/game_session.h"
+#include "pill_game/game/level_corpus.h"
+
+namespace pill_game::bench {
+
+namespace {
+
+using game::GameSession;
+using game::LevelCorpus;
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t SESSION_STARTS = 1 << 18;
+
+struct StartResult {
+    double NsPerStart{0.0};
+    uint64_t Enemies{0};  // keeps the starts from being optimised away
+};
+
+StartResult time_starts(GameSession& session, const LevelCorpus* corpus) noexcept {
+    StartResult result{};
+    const auto start = Clock::now();
+    for (uint32_t i = 0; i < SESSION_STARTS; ++i) {
+        const uint32_t set = i % game::CORPUS_SET_COUNT;
+        session.start(
+            i / game::CORPUS_SET_COUNT,
+            static_cast<uint8_t>(game::CORPUS_MIN_LEVEL + (set / 4)),
+            (set & 1U) != 0,
+            (set & 2U) != 0,
+            MatchRule::Lines,
+            corpus
+        );
+        result.Enemies += session.Board.enemy_count();
+    }
+    result.NsPerStart = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / SESSION_STARTS;
+    return result;
+}
+
+}  // namespace
+
+int run_corpus_build(const fs::path& path, uint32_t boards_per_set) noexcept {
+    try {
+        const auto start = Clock::now();
+        const game::CorpusBuildStats stats = game::build_level_corpus(path, boards_per_set);
+        const auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        PG_LOG(
+            Info,
+            "wrote {} boards ({} replaced) to {} in {:.2f} s, {} bytes",
+            stats.Boards,
+            stats.Rejected,
+            path.string(),
+            seconds,
+            fs::file_size(path)
+        );
+        return 0;
+
+    } catch (const std::exception& ex) {
+        PG_LOG(Err, "corpus build failed - {}", ex.what());
+        return -1;
+    }
+}
+
+int run_corpus_benchmark(const fs::path& path) noexcept {
+    try {
+        const LevelCorpus corpus{path};
+        auto session = std::make_unique<GameSession>();
+        auto generated = std::make_unique<GameSession>();
+
+        // both starts agree on every seed the build kept
+        uint32_t matched{0};
+        uint32_t replaced{0};
+        for (uint32_t set = 0; set < game::CORPUS_SET_COUNT; ++set) {
+            const auto level = static_cast<uint8_t>(game::CORPUS_MIN_LEVEL + (set / 4));
+            for (uint32_t seed = 0; seed < std::min(corpus.boards_per_set(), 64U); ++seed) {
+                session->start(seed, level, (set & 1U) != 0, (set & 2U) != 0, MatchRule::Lines, &corpus);
+                generated->start(seed, level, (set & 1U) != 0, (set & 2U) != 0, MatchRule::Lines, nullptr);
+                const bool same = std::memcmp(&session->Board, &generated->Board, sizeof(PillGameBoard)) == 0;
+                matched += same ? 1 : 0;
+                replaced += same ? 0 : 1;
+            }
+        }
+
+        const StartResult from_corpus = time_starts(*session, &corpus);
+        const StartResult from_generator = time_starts(*generated, nullptr);
+
+        PG_LOG(Info, "corpus        : {} boards a set, fingerprint {:08x}", corpus.boards_per_set(), corpus.fingerprint());
+        PG_LOG(Info, "checked       : {} boards match the generator, {} were replaced", matched, replaced);
+        PG_LOG(Info, "start (corpus): {:>8.0f} ns", from_corpus.NsPerStart);
+        PG_LOG(Info, "start (gen)   : {:>8.0f} ns", from_generator.NsPerStart);
+        PG_LOG(
+            Info,
+            "speed up      : {:.1f}x, {} / {} enemies",
+            from_generator.NsPerStart / from_corpus.NsPerStart,
+            from_corpus.Enemies,
+            from_generator.Enemies
+        );
+        return 0;
+
+    } catch (const std::exception& ex) {
+        PG_LOG(Err, "corpus benchmark failed - {}", ex.what());
+        return -1;
+    }
+}
+
+}  // namespace pill_game::bench
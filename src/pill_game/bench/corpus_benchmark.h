@@ -0,0 +1,23 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+namespace pill_game::bench {
+
+// Writes a level corpus of 'boards_per_set' boards for every difficulty setting
+int run_corpus_build(const fs::path& path, uint32_t boards_per_set) noexcept;
+
+//
+// Starts sessions over every level with boards taken from the corpus at
+// 'path' and with generated boards, and reports the cost of each. Boards the
+// build didn't have to replace must match the generator exactly.
+//
+int run_corpus_benchmark(const fs::path& path) noexcept;
+
+}  // namespace pill_game::bench
@@ -0,0 +1,148 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/bench/large_board_benchmark.h"
+
+#include "pill_game/game/board.h"
+#include "pill_game/game/dynamic_board.h"
+
+namespace pill_game::bench {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t fill_percent = 45;
+constexpr uint64_t cells_per_size = 1ULL << 24;  // work per board size, so small boards repeat more
+constexpr uint32_t max_settle_ticks = 100000;
+constexpr uint32_t idle_ticks = 1000;
+
+// The fixed engines' sizes first, for a like for like comparison
+constexpr std::array<std::array<uint32_t, 2>, 9> dynamic_sizes{{
+    {8, 16},
+    {10, 20},
+    {16, 64},
+    {32, 128},
+    {64, 256},
+    {128, 512},
+    {256, 1024},
+    {512, 2048},
+    {1024, 4096},
+}};
+
+double ns_since(Clock::time_point start) noexcept {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+struct ScalingResult {
+    double BreakNsPerCell{0.0};
+    double SettleNsPerCell{0.0};  // per tick, while the board is still moving
+    double IdleTickNs{0.0};       // one tick once it has stopped
+    uint64_t SettleTicks{0};      // ticks for a filled board to stop, on average
+};
+
+//
+// Fills a board, breaks it once and lets it fall until it stops, over and
+// over; 'fill' sets up the board for a round and the rest is timed.
+//
+template <typename Board, typename Fill, typename Settled>
+ScalingResult measure(Board& board, uint64_t cells, Fill&& fill, Settled&& settled) {
+    const uint64_t rounds = std::max<uint64_t>(cells_per_size / cells, 1);
+
+    double break_ns{0.0};
+    double settle_ns{0.0};
+    uint64_t settle_ticks{0};
+    for (uint64_t round = 0; round < rounds; ++round) {
+        fill(static_cast<uint32_t>(round));
+
+        auto start = Clock::now();
+        board.break_pieces();
+        break_ns += ns_since(start);
+
+        start = Clock::now();
+        for (uint32_t tick = 0; tick < max_settle_ticks && !settled(board.tick_gravity()); ++tick) {
+            ++settle_ticks;
+        }
+        settle_ns += ns_since(start);
+    }
+
+    const auto start = Clock::now();
+    for (uint32_t i = 0; i < idle_ticks; ++i) {
+        board.tick_gravity();
+    }
+    const double idle_ns = ns_since(start);
+
+    return ScalingResult{
+        .BreakNsPerCell = break_ns / static_cast<double>(rounds * cells),
+        .SettleNsPerCell = settle_ns / static_cast<double>(std::max<uint64_t>(settle_ticks, 1) * cells),
+        .IdleTickNs = idle_ns / idle_ticks,
+        .SettleTicks = settle_ticks / rounds,
+    };
+}
+
+ScalingResult measure_dynamic(uint32_t width, uint32_t height) {
+    DynamicPillGameBoard board{width, height};
+    return measure(
+        board,
+        static_cast<uint64_t>(width) * height,
+        [&board](uint32_t seed) { board.fill_random(seed, fill_percent); },
+        [&board](int32_t) { return board.is_settled(); }
+    );
+}
+
+// The same boards as measure_dynamic() gives, on a fixed size engine
+template <typename Board>
+ScalingResult measure_fixed() {
+    auto board = std::make_unique<Board>();
+    DynamicPillGameBoard source{Board::WIDTH, Board::HEIGHT};
+    return measure(
+        *board,
+        Board::SIZE,
+        [&board, &source](uint32_t seed) {
+            source.fill_random(seed, fill_percent);
+            std::ranges::copy(source.cells(), board->flat_game_board().begin());
+            board->recompute_stats();
+        },
+        [](int32_t moved) { return moved == 0; }
+    );
+}
+
+void log_result(std::string_view engine, size_t width, size_t height, const ScalingResult& result) {
+    PG_LOG(
+        Info,
+        "{:<8} {:>4}x{:<5}: break {:>5.2f} ns/cell, settle {:>4} ticks at {:>5.2f} ns/cell, idle tick {:>9.0f} ns",
+        engine,
+        width,
+        height,
+        result.BreakNsPerCell,
+        result.SettleTicks,
+        result.SettleNsPerCell,
+        result.IdleTickNs
+    );
+}
+
+}  // namespace
+
+int run_large_board_benchmark(uint32_t max_width) noexcept {
+    try {
+        log_result("fixed", GAME_BOARD_WIDTH, GAME_BOARD_HEIGHT, measure_fixed<PillGameBoard>());
+        log_result("fixed", MARATHON_BOARD_WIDTH, MARATHON_BOARD_HEIGHT, measure_fixed<MarathonBoard>());
+
+        for (const auto& [width, height] : dynamic_sizes) {
+            if (width <= max_width) {
+                log_result("dynamic", width, height, measure_dynamic(width, height));
+            }
+        }
+        return 0;
+
+    } catch (const std::exception& ex) {
+        PG_LOG(Err, "large board benchmark failed - {}", ex.what());
+        return -1;
+    }
+}
+
+}  // namespace pill_game::bench
@@ -0,0 +1,20 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+namespace pill_game::bench {
+
+//
+// Break and gravity cost per cell on runtime sized boards from 8x16 up to
+// 'max_width' wide, against the fixed 8x16 and 10x20 engines on the same
+// boards, to show how each scales.
+//
+int run_large_board_benchmark(uint32_t max_width) noexcept;
+
+}  // namespace pill_game::bench
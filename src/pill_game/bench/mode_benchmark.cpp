@@ -0,0 +1,79 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/bench/mode_benchmark.h"
+
+#include "pill_game/bench/bot_input.h"
+#include "pill_game/game/game_session.h"
+
+namespace pill_game::bench {
+
+namespace {
+
+using game::TickInput;
+using Clock = std::chrono::steady_clock;
+
+constexpr uint8_t max_level = 20;
+constexpr uint64_t max_game_ticks = 10ULL * 60 * game::SIM_TICK_RATE;
+
+template <typename Session>
+void play_mode(std::string_view name, uint32_t game_count) {
+    auto session = std::make_unique<Session>();
+    uint64_t ticks{0};
+    uint32_t wins{0};
+
+    const auto start = Clock::now();
+    for (uint32_t seed = 1; seed <= game_count; ++seed) {
+        // no corpus; they only hold classic boards
+        session->start(seed, static_cast<uint8_t>(1 + (seed % max_level)), true, (seed % 2) != 0, MatchRule::Lines, nullptr);
+
+        uint32_t bot{seed * 2654435761U};
+        TickInput input{};
+        while (!session->Finished && session->Ticks < max_game_ticks) {
+            if (const auto event = bot_input(bot)) {
+                input.apply(*event);
+            }
+            session->tick(input);
+            input.next_tick();
+        }
+
+        ticks += session->Ticks;
+        wins += session->is_won() ? 1 : 0;
+    }
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    PG_LOG(
+        Info,
+        "{:<9}: {}x{} board, {} B session, {:.0f} ticks/s, {:.0f} ticks a game, {} of {} won",
+        name,
+        Session::BoardType::WIDTH,
+        Session::BoardType::HEIGHT,
+        sizeof(Session),
+        seconds > 0.0 ? static_cast<double>(ticks) / seconds : 0.0,
+        static_cast<double>(ticks) / static_cast<double>(game_count),
+        wins,
+        game_count
+    );
+}
+
+}  // namespace
+
+int run_mode_benchmark(uint32_t game_count) noexcept {
+    try {
+        game_count = std::max<uint32_t>(game_count, 1);
+        play_mode<game::GameSession>("classic", game_count);
+        play_mode<game::SprintGameSession>("sprint", game_count);
+        play_mode<game::MarathonGameSession>("marathon", game_count);
+        return 0;
+
+    } catch (const std::exception& ex) {
+        PG_LOG(Err, "mode benchmark failed - {}", ex.what());
+        return -1;
+    }
+}
+
+}  // namespace pill_game::bench
@@ -0,0 +1,19 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+namespace pill_game::bench {
+
+//
+// Plays 'game_count' bot games on each board size (classic, sprint and
+// marathon) through the same session code and reports how fast each ticks.
+//
+int run_mode_benchmark(uint32_t game_count) noexcept;
+
+}  // namespace pill_game::bench
@@ -0,0 +1,144 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/bench/packing_benchmark.h"
+
+#include "pill_game/bench/bot_input.h"
+#include "pill_game/game/packed_board.h"
+#include "pill_game/game/position_file.h"
+#include "pill_game/game/session_pool.h"
+
+namespace pill_game::bench {
+
+namespace {
+
+using game::SessionId;
+using game::SessionPool;
+using Clock = std::chrono::steady_clock;
+
+// clang-format off
+constexpr uint32_t SOURCE_SESSIONS  = 1024;
+constexpr uint32_t TICKS_PER_SAMPLE = 7;
+constexpr uint8_t  MAX_LEVEL        = 20;
+// clang-format on
+
+void start_session(SessionPool& pool, uint32_t seed) noexcept {
+    pool.create(seed, static_cast<uint8_t>(1 + (seed % MAX_LEVEL)), true, (seed % 2) != 0, MatchRule::Lines);
+}
+
+// Boards from bot games at every stage of play
+std::vector<PillGameBoard> sample_boards(uint32_t count) {
+    std::vector<PillGameBoard> boards{};
+    boards.reserve(count);
+
+    SessionPool pool{SOURCE_SESSIONS};
+    uint32_t next_seed{1};
+    uint32_t bot{0x9E3779B9U};
+    for (uint32_t i = 0; i < SOURCE_SESSIONS; ++i) {
+        start_session(pool, next_seed++);
+    }
+
+    while (boards.size() < count) {
+        for (uint32_t t = 0; t < TICKS_PER_SAMPLE; ++t) {
+            for (SessionId id = 0; id < SOURCE_SESSIONS; ++id) {
+                // busier than the other bots, for more varied boards
+                if (const auto event = bot_input(bot, 4)) {
+                    pool.input(id).apply(*event);
+                }
+            }
+            pool.tick_all();
+        }
+
+        for (SessionId id = 0; id < SOURCE_SESSIONS && boards.size() < count; ++id) {
+            boards.push_back(pool.session(id).Board);
+            if (pool.session(id).Finished) {
+                pool.destroy(id);
+                start_session(pool, next_seed++);
+            }
+        }
+    }
+    return boards;
+}
+
+double gib_per_second(size_t bytes, Clock::duration time) noexcept {
+    return static_cast<double>(bytes) / (std::chrono::duration<double>(time).count() * 1024.0 * 1024.0 * 1024.0);
+}
+
+}  // namespace
+
+int run_packing_benchmark(uint32_t board_count) noexcept {
+    try {
+        board_count = std::max(1U, board_count);
+        const std::vector<PillGameBoard> boards = sample_boards(board_count);
+        std::vector<PillGameBoard> unpacked(board_count);
+        std::vector<PackedBoard> packed(board_count);
+        const size_t board_bytes = board_count * sizeof(PillGameBoard);
+
+        auto start = Clock::now();
+        std::memcpy(unpacked.data(), boards.data(), board_bytes);
+        const auto copy_time = Clock::now() - start;
+
+        start = Clock::now();
+        for (uint32_t i = 0; i < board_count; ++i) {
+            pack_board(boards[i], packed[i]);
+        }
+        const auto pack_time = Clock::now() - start;
+
+        uint32_t invalid{0};
+        start = Clock::now();
+        for (uint32_t i = 0; i < board_count; ++i) {
+            invalid += unpack_board(packed[i], unpacked[i]) ? 0 : 1;
+        }
+        const auto unpack_time = Clock::now() - start;
+
+        uint32_t mismatches{0};
+        for (uint32_t i = 0; i < board_count; ++i) {
+            mismatches += std::memcmp(&boards[i], &unpacked[i], sizeof(PillGameBoard)) == 0 ? 0 : 1;
+        }
+
+        // the file holds positions, so give every board an arbitrary piece
+        const fs::path path = fs::temp_directory_path() / std::format("pill_game_bench{}", game::POSITION_EXTENSION);
+        start = Clock::now();
+        {
+            game::PositionWriter writer{path};
+            for (uint32_t i = 0; i < board_count; ++i) {
+                writer.write(game::PackedPosition{packed[i], pack_piece(ALL_PIECES.at(i % ALL_PIECES.size())), i});
+            }
+            writer.finish();
+        }
+        const auto write_time = Clock::now() - start;
+
+        start = Clock::now();
+        const std::vector<game::PackedPosition> loaded = game::load_positions(path);
+        const auto read_time = Clock::now() - start;
+        const size_t file_size = fs::file_size(path);
+        fs::remove(path);
+
+        for (uint32_t i = 0; i < board_count; ++i) {
+            mismatches += i < loaded.size() && loaded[i].Board == packed[i] ? 0 : 1;
+        }
+
+        const auto ns_per_board = [board_count](Clock::duration time) {
+            return std::chrono::duration<double, std::nano>(time).count() / board_count;
+        };
+
+        PG_LOG(Info, "boards        : {} ({} B unpacked, {} B packed)", board_count, sizeof(PillGameBoard), PACKED_BOARD_SIZE);
+        PG_LOG(Info, "memcpy        : {:.2f} GiB/s", gib_per_second(board_bytes, copy_time));
+        PG_LOG(Info, "pack          : {:.1f} ns per board, {:.2f} GiB/s of boards in", ns_per_board(pack_time), gib_per_second(board_bytes, pack_time));
+        PG_LOG(Info, "unpack        : {:.1f} ns per board, {:.2f} GiB/s of boards out", ns_per_board(unpack_time), gib_per_second(board_bytes, unpack_time));
+        PG_LOG(Info, "position file : {:.1f} MiB, write {:.2f} GiB/s, read {:.2f} GiB/s", static_cast<double>(file_size) / (1024.0 * 1024.0), gib_per_second(file_size, write_time), gib_per_second(file_size, read_time));
+        PG_LOG(Info, "mismatches    : {}, invalid {}", mismatches, invalid);
+
+        return mismatches == 0 && invalid == 0 ? 0 : -1;
+
+    } catch (const std::exception& ex) {
+        PG_LOG(Err, "packing benchmark failed - {}", ex.what());
+        return -1;
+    }
+}
+
+}  // namespace pill_game::bench
@@ -0,0 +1,21 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+namespace pill_game::bench {
+
+//
+// Packs and unpacks 'board_count' boards taken from bot games, checking every
+// one comes back unchanged, and compares the rates with a plain memcpy of the
+// same boards. Then writes them all to a position file in the temp directory
+// and loads it back.
+//
+int run_packing_benchmark(uint32_t board_count) noexcept;
+
+}  // namespace pill_game::bench
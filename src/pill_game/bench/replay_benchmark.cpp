@@ -0,0 +1,174 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/bench/replay_benchmark.h"
+
+#include "pill_game/game/game_session.h"
+#include "pill_game/game/replay.h"
+#include "pill_game/util/alloc_tracker.h"
+
+namespace pill_game::bench {
+
+namespace {
+
+using game::TickInput;
+using game::GameSession;
+using game::Replay;
+using Clock = std::chrono::steady_clock;
+
+constexpr auto min_bench_duration = std::chrono::seconds{1};
+
+struct CorpusResult {
+    uint64_t Ticks{0};
+    uint64_t Checksum{0};  // keeps the simulation from being optimised away
+};
+
+std::vector<Replay> load_corpus(const fs::path& directory) {
+    std::vector<Replay> replays{};
+
+    for (const auto& entry : fs::directory_iterator{directory}) {
+        if (!entry.is_regular_file() || entry.path().extension() != game::REPLAY_EXTENSION) {
+            continue;
+        }
+
+        try {
+            replays.push_back(game::load_replay(entry.path()));
+        } catch (const std::exception& ex) {
+            PG_LOG(Warn, "skipping replay - {}", ex.what());
+        }
+    }
+
+    return replays;
+}
+
+CorpusResult simulate_corpus(const std::vector<Replay>& replays, GameSession& session) noexcept {
+    CorpusResult result{};
+    for (const Replay& replay : replays) {
+        replay.start_session(session);
+        for (const TickInput& input : replay.Inputs) {
+            session.tick(input);
+        }
+        result.Ticks += replay.Inputs.size();
+        result.Checksum += session.Board.enemy_count();
+    }
+    return result;
+}
+
+uint32_t count_desyncs(const std::vector<Replay>& replays) {
+    uint32_t desyncs{0};
+    auto session = std::make_unique<GameSession>();
+
+    for (const Replay& replay : replays) {
+        replay.start_session(*session);
+        for (const TickInput& input : replay.Inputs) {
+            session->tick(input);
+        }
+        if (session->Board.enemy_count() != replay.Header.FinalEnemyCount) {
+            PG_LOG(Warn, "replay with seed {} did not reproduce its recorded result", replay.Header.Seed);
+            ++desyncs;
+        }
+    }
+
+    return desyncs;
+}
+
+double ticks_per_second(uint64_t ticks, Clock::duration elapsed) noexcept {
+    const auto seconds = std::chrono::duration<double>(elapsed).count();
+    return seconds > 0.0 ? static_cast<double>(ticks) / seconds : 0.0;
+}
+
+}  // namespace
+
+int run_replay_benchmark(const fs::path& directory, uint32_t thread_count) noexcept {
+    try {
+        const std::vector<Replay> replays = load_corpus(directory);
+        if (replays.empty()) {
+            PG_LOG(Err, "no replays found in {}", directory.string());
+            return -1;
+        }
+
+        if (thread_count == 0) {
+            thread_count = std::max(std::thread::hardware_concurrency(), 1U);
+        }
+
+        const uint32_t desyncs = count_desyncs(replays);
+        PG_LOG(Info, "loaded {} replays ({} desynced)", replays.size(), desyncs);
+
+        // Single threaded; repeat the corpus until the run is long enough to be stable
+        uint32_t passes{0};
+        CorpusResult single{};
+        auto session = std::make_unique<GameSession>();
+        memory::end_frame();
+        const auto single_start = Clock::now();
+        while (Clock::now() - single_start < min_bench_duration) {
+            const CorpusResult pass = simulate_corpus(replays, *session);
+            single.Ticks += pass.Ticks;
+            single.Checksum += pass.Checksum;
+            ++passes;
+        }
+        const auto single_elapsed = Clock::now() - single_start;
+        const auto single_allocs = memory::end_frame().total();
+
+        // Every worker simulates the whole corpus the same number of times
+        std::vector<CorpusResult> results(thread_count);
+        std::vector<std::thread> workers{};
+        workers.reserve(thread_count);
+
+        const auto multi_start = Clock::now();
+        for (uint32_t i = 0; i < thread_count; ++i) {
+            workers.emplace_back([&replays, &result = results.at(i), passes]() {
+                auto worker_session = std::make_unique<GameSession>();
+                for (uint32_t pass = 0; pass < passes; ++pass) {
+                    const CorpusResult r = simulate_corpus(replays, *worker_session);
+                    result.Ticks += r.Ticks;
+                    result.Checksum += r.Checksum;
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        const auto multi_elapsed = Clock::now() - multi_start;
+
+        CorpusResult multi{};
+        for (const CorpusResult& r : results) {
+            multi.Ticks += r.Ticks;
+            multi.Checksum += r.Checksum;
+        }
+
+        const double single_rate = ticks_per_second(single.Ticks, single_elapsed);
+        const double multi_rate = ticks_per_second(multi.Ticks, multi_elapsed);
+
+        PG_LOG(Info, "single thread : {:>14.0f} ticks/s ({} ticks, {} passes)", single_rate, single.Ticks, passes);
+        PG_LOG(Info, "{:>3} threads   : {:>14.0f} ticks/s ({} ticks)", thread_count, multi_rate, multi.Ticks);
+        PG_LOG(
+            Info,
+            "scaling       : {:.2f}x ({:.0f}% efficiency), checksum {}",
+            multi_rate / single_rate,
+            (100.0 * multi_rate) / (single_rate * static_cast<double>(thread_count)),
+            single.Checksum + multi.Checksum
+        );
+
+        if constexpr (memory::ALLOC_TRACKING_ENABLED) {
+            PG_LOG(
+                Info,
+                "allocations   : {} ({} bytes) over {} single thread ticks",
+                single_allocs.Allocations,
+                single_allocs.Bytes,
+                single.Ticks
+            );
+        }
+
+        return desyncs == 0 ? 0 : 1;
+
+    } catch (const std::exception& ex) {
+        PG_LOG(Err, "replay benchmark failed - {}", ex.what());
+        return -1;
+    }
+}
+
+}  // namespace pill_game::bench
@@ -0,0 +1,20 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+namespace pill_game::bench {
+
+//
+// Loads every replay in 'directory' and re-simulates them headlessly through
+// GameSession::tick, reporting simulated ticks per second on one thread and
+// on 'thread_count' threads (0 = all cores).
+//
+int run_replay_benchmark(const fs::path& directory, uint32_t thread_count) noexcept;
+
+}  // namespace pill_game::bench
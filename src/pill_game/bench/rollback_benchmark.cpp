@@ -0,0 +1,215 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/bench/rollback_benchmark.h"
+
+#include "pill_game/bench/bot_input.h"
+#include "pill_game/game/loopback_transport.h"
+#include "pill_game/game/rollback.h"
+
+namespace pill_game::bench {
+
+namespace {
+
+using game::LoopbackSettings;
+using game::LoopbackTransport;
+using game::MatchState;
+using game::PlayerId;
+using game::RollbackMatch;
+using game::TickInput;
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t timing_iterations = 100'000;
+constexpr uint64_t match_ticks = 60ULL * game::SIM_TICK_RATE;
+constexpr uint32_t max_drain_steps = 100'000;
+constexpr uint32_t match_seed = 0xC0FFEE;
+constexpr uint8_t match_level = 10;
+
+struct Bot {
+    uint32_t State{1};
+    TickInput Input{};
+
+    const TickInput& next() noexcept {
+        Input.next_tick();
+        if (const auto event = bot_input(State)) {
+            Input.apply(*event);
+        }
+        return Input;
+    }
+};
+
+double nanoseconds_per(Clock::duration elapsed, uint32_t count) noexcept {
+    return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(count);
+}
+
+void time_snapshots(void) {
+    auto state = std::make_unique<MatchState>();
+    auto ring = std::make_unique<std::array<MatchState, game::ROLLBACK_RING_SIZE>>();
+    for (game::GameSession& session : state->Sessions) {
+        session.start(match_seed, match_level, true, false, MatchRule::Lines);
+    }
+
+    const auto save_start = Clock::now();
+    for (uint32_t i = 0; i < timing_iterations; ++i) {
+        ring->at(i % ring->size()) = *state;
+        state->Sessions.at(0).Ticks = i;  // keep the copies from being folded away
+    }
+    const auto save_elapsed = Clock::now() - save_start;
+
+    const auto restore_start = Clock::now();
+    uint64_t sink{0};
+    for (uint32_t i = 0; i < timing_iterations; ++i) {
+        *state = ring->at(i % ring->size());
+        sink += state->Sessions.at(0).Ticks;
+    }
+    const auto restore_elapsed = Clock::now() - restore_start;
+
+    PG_LOG(Info, "state size    : {} bytes per snapshot", sizeof(MatchState));
+    PG_LOG(Info, "snapshot      : {:.1f} ns", nanoseconds_per(save_elapsed, timing_iterations));
+    PG_LOG(Info, "restore       : {:.1f} ns (sink {})", nanoseconds_per(restore_elapsed, timing_iterations), sink);
+}
+
+void time_resimulation(void) {
+    // restore, then ROLLBACK_MAX_TICKS for every player; the most one frame can be asked for
+    Bot bot{};
+    auto match = std::make_unique<MatchState>();
+    for (game::GameSession& session : match->Sessions) {
+        session.start(match_seed, match_level, true, false, MatchRule::Lines);
+
+        // past the board build, into actual play
+        while (session.is_building()) {
+            session.tick(bot.next());
+        }
+    }
+    const auto snapshot = std::make_unique<MatchState>(*match);
+
+    constexpr uint32_t rollbacks = timing_iterations / game::ROLLBACK_MAX_TICKS;
+    Clock::duration worst{};
+
+    const auto start = Clock::now();
+    for (uint32_t i = 0; i < rollbacks; ++i) {
+        const auto rollback_start = Clock::now();
+        *match = *snapshot;
+        for (uint32_t tick = 0; tick < game::ROLLBACK_MAX_TICKS; ++tick) {
+            for (game::GameSession& session : match->Sessions) {
+                session.tick(bot.next());
+            }
+        }
+        worst = std::max(worst, Clock::now() - rollback_start);
+    }
+    const auto elapsed = Clock::now() - start;
+
+    PG_LOG(
+        Info,
+        "resimulate    : {:.2f} us for {} ticks, worst {:.2f} us",
+        nanoseconds_per(elapsed, rollbacks) / 1000.0,
+        game::ROLLBACK_MAX_TICKS,
+        std::chrono::duration<double, std::micro>(worst).count()
+    );
+}
+
+void exchange(std::array<RollbackMatch, game::MATCH_PLAYERS>& peers, LoopbackTransport& transport, uint64_t now) {
+    for (PlayerId player = 0; player < game::MATCH_PLAYERS; ++player) {
+        while (const auto packet = transport.receive(player, now)) {
+            peers.at(player).receive(*packet);
+        }
+    }
+    for (PlayerId player = 0; player < game::MATCH_PLAYERS; ++player) {
+        const RollbackMatch& peer = peers.at(player);
+        transport.send(peer.remote_player(), peer.make_packet(), now);
+    }
+}
+
+bool play_loopback_match(const LoopbackSettings& settings) {
+    auto peers = std::make_unique<std::array<RollbackMatch, game::MATCH_PLAYERS>>();
+    LoopbackTransport transport{settings};
+    std::array<Bot, game::MATCH_PLAYERS> bots{Bot{1}, Bot{2}};
+
+    for (PlayerId player = 0; player < game::MATCH_PLAYERS; ++player) {
+        peers->at(player).start(player, match_seed, match_level, true, false, MatchRule::Lines);
+    }
+
+    // both peers run in lock step on the same clock; only the transport delays things
+    uint64_t now{0};
+    const auto start = Clock::now();
+    while (peers->at(0).tick() < match_ticks || peers->at(1).tick() < match_ticks) {
+        exchange(*peers, transport, now);
+        for (PlayerId player = 0; player < game::MATCH_PLAYERS; ++player) {
+            RollbackMatch& peer = peers->at(player);
+            if (peer.tick() < match_ticks && peer.can_advance()) {
+                peer.advance(bots.at(player).next());
+            } else if (peer.tick() < match_ticks) {
+                peer.advance(TickInput{});  // counted as a stall
+            }
+        }
+        ++now;
+    }
+    const auto elapsed = Clock::now() - start;
+
+    // let every input arrive, then both peers must agree exactly
+    uint32_t steps{0};
+    while ((peers->at(0).confirmed_tick() < match_ticks || peers->at(1).confirmed_tick() < match_ticks)
+           && steps++ < max_drain_steps) {
+        exchange(*peers, transport, now++);
+    }
+
+    bool in_sync{true};
+    for (RollbackMatch& peer : *peers) {
+        peer.synchronise();
+    }
+    for (PlayerId player = 0; player < game::MATCH_PLAYERS; ++player) {
+        const uint64_t lhs = game::session_checksum(peers->at(0).session(player));
+        const uint64_t rhs = game::session_checksum(peers->at(1).session(player));
+        if (lhs != rhs) {
+            PG_LOG(Warn, "peers disagree on player {} ({:x} vs {:x})", player, lhs, rhs);
+            in_sync = false;
+        }
+    }
+
+    for (PlayerId player = 0; player < game::MATCH_PLAYERS; ++player) {
+        const auto& stats = peers->at(player).stats();
+        PG_LOG(
+            Info,
+            "peer {}        : {} rollbacks, {} ticks resimulated (max {}), {} stalls",
+            player,
+            stats.Rollbacks,
+            stats.ResimulatedTicks,
+            stats.MaxRollbackTicks,
+            stats.StalledTicks
+        );
+    }
+    PG_LOG(
+        Info,
+        "loopback      : {} ticks in {:.1f} ms, {} packets sent, {} dropped, {}",
+        match_ticks,
+        std::chrono::duration<double, std::milli>(elapsed).count(),
+        transport.sent(),
+        transport.dropped(),
+        in_sync ? "in sync" : "DESYNCED"
+    );
+
+    return in_sync;
+}
+
+}  // namespace
+
+int run_rollback_benchmark(uint32_t latency_ticks, uint32_t loss_percent) noexcept {
+    try {
+        time_snapshots();
+        time_resimulation();
+
+        const LoopbackSettings settings{latency_ticks, std::min(loss_percent, 99U), match_seed};
+        PG_LOG(Info, "latency       : {} ticks one way, {}% loss", settings.LatencyTicks, settings.LossPercent);
+        return play_loopback_match(settings) ? 0 : 1;
+
+    } catch (const std::exception& ex) {
+        PG_LOG(Err, "rollback benchmark failed - {}", ex.what());
+        return -1;
+    }
+}
+
+}  // namespace pill_game::bench
@@ -0,0 +1,21 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+namespace pill_game::bench {
+
+//
+// Times snapshot, restore and a worst case (ROLLBACK_MAX_TICKS) re-simulation,
+// then plays two bot peers against each other over a LoopbackTransport with
+// the given one way latency (in ticks) and packet loss. Fails if the peers
+// don't agree on both sessions once every input has been exchanged.
+//
+int run_rollback_benchmark(uint32_t latency_ticks, uint32_t loss_percent) noexcept;
+
+}  // namespace pill_game::bench
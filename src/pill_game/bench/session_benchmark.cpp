@@ -0,0 +1,83 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/bench/session_benchmark.h"
+
+#include "pill_game/bench/bot_input.h"
+#include "pill_game/game/session_pool.h"
+
+namespace pill_game::bench {
+
+namespace {
+
+using game::SessionId;
+using game::SessionPool;
+using Clock = std::chrono::steady_clock;
+
+constexpr auto min_bench_duration = std::chrono::seconds{1};
+constexpr uint8_t max_level = 20;
+
+void start_session(SessionPool& pool, uint32_t seed) noexcept {
+    pool.create(seed, static_cast<uint8_t>(1 + (seed % max_level)), true, (seed % 2) != 0, MatchRule::Lines);
+}
+
+}  // namespace
+
+int run_session_benchmark(uint32_t session_count) noexcept {
+    try {
+        SessionPool pool{session_count};
+        std::vector<uint32_t> bots(session_count);
+
+        uint32_t next_seed{1};
+        for (uint32_t i = 0; i < session_count; ++i) {
+            bots.at(i) = next_seed * 2654435761U;
+            start_session(pool, next_seed++);
+        }
+
+        uint64_t pool_ticks{0};
+        uint64_t games_finished{0};
+        const auto start = Clock::now();
+
+        while (Clock::now() - start < min_bench_duration) {
+            // bots press or release one of the gameplay buttons now and again
+            for (SessionId id = 0; id < session_count; ++id) {
+                if (const auto event = bot_input(bots.at(id))) {
+                    pool.input(id).apply(*event);
+                }
+            }
+
+            pool.tick_all();
+            ++pool_ticks;
+
+            for (SessionId id = 0; id < session_count; ++id) {
+                if (pool.session(id).Finished) {
+                    pool.destroy(id);
+                    start_session(pool, next_seed++);
+                    ++games_finished;
+                }
+            }
+        }
+
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        const uint64_t session_ticks = pool_ticks * session_count;
+        const double ticks_per_second = static_cast<double>(session_ticks) / seconds;
+        constexpr size_t bytes_per_session = sizeof(game::GameSession) + sizeof(game::TickInput) + sizeof(uint8_t);
+
+        PG_LOG(Info, "sessions      : {} ({} bytes each, {:.2f} MiB)", session_count, bytes_per_session, static_cast<double>(bytes_per_session * session_count) / (1024.0 * 1024.0));
+        PG_LOG(Info, "pool tick     : {:.2f} us for every session", (seconds * 1.0e6) / static_cast<double>(pool_ticks));
+        PG_LOG(Info, "throughput    : {:.0f} session ticks/s, {} games finished", ticks_per_second, games_finished);
+        PG_LOG(Info, "real time cap : ~{:.0f} sessions per core at {} Hz", ticks_per_second / game::SIM_TICK_RATE, game::SIM_TICK_RATE);
+
+        return 0;
+
+    } catch (const std::exception& ex) {
+        PG_LOG(Err, "session benchmark failed - {}", ex.what());
+        return -1;
+    }
+}
+
+}  // namespace pill_game::bench
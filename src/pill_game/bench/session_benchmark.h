@@ -0,0 +1,20 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+namespace pill_game::bench {
+
+//
+// Runs 'session_count' concurrent sessions in one SessionPool, driven by
+// random inputs, and reports per-session memory and how many real-time
+// (SIM_TICK_RATE) sessions a single core could host.
+//
+int run_session_benchmark(uint32_t session_count) noexcept;
+
+}  // namespace pill_game::bench
@@ -0,0 +1,129 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/bench/spectator_benchmark.h"
+
+#include "pill_game/bench/bot_input.h"
+#include "pill_game/game/session_pool.h"
+#include "pill_game/net/protocol.h"
+#include "pill_game/net/spectator_stream.h"
+
+namespace pill_game::bench {
+
+namespace {
+
+using game::SessionId;
+using game::SessionPool;
+using Clock = std::chrono::steady_clock;
+
+// clang-format off
+constexpr uint64_t GAME_TICKS      = 60 * game::SIM_TICK_RATE;
+constexpr uint8_t  MAX_LEVEL       = 20;
+constexpr size_t   FULL_STATE_SIZE = GAME_BOARD_SIZE + sizeof(BoardPiece) + sizeof(uint32_t) + sizeof(uint32_t);
+// clang-format on
+
+void start_session(SessionPool& pool, uint32_t seed) noexcept {
+    pool.create(seed, static_cast<uint8_t>(1 + (seed % MAX_LEVEL)), true, (seed % 2) != 0, MatchRule::Lines);
+}
+
+bool same_view(const net::SpectatorView& view, const game::GameSession& session) noexcept {
+    const auto& cells = session.Board.flat_game_board();
+    return std::memcmp(view.Board.flat_game_board().data(), cells.data(), sizeof(cells)) == 0
+           && std::bit_cast<uint8_t>(view.Piece.Left) == std::bit_cast<uint8_t>(session.Piece.Left)
+           && std::bit_cast<uint8_t>(view.Piece.Right) == std::bit_cast<uint8_t>(session.Piece.Right)
+           && view.Piece.Rotation == session.Piece.Rotation
+           && view.Piece.Row == session.Piece.Row
+           && view.Piece.Column == session.Piece.Column
+           && view.Score == session.Score;
+}
+
+}  // namespace
+
+int run_spectator_benchmark(uint32_t session_count) noexcept {
+    try {
+        session_count = std::max(1U, session_count);
+        SessionPool pool{session_count};
+        std::vector<uint32_t> bots(session_count);
+        std::vector<net::SpectatorEncoder> encoders(session_count);
+        std::vector<net::SpectatorDecoder> decoders(session_count);
+        std::vector<net::BoardMirror> mirrors(session_count);
+
+        uint32_t next_seed{1};
+        for (uint32_t i = 0; i < session_count; ++i) {
+            bots.at(i) = next_seed * 2654435761U;
+            start_session(pool, next_seed++);
+        }
+
+        std::vector<net::SpectatorFrame> frames(session_count);
+        std::vector<size_t> frame_sizes(session_count);
+        net::MessageBuffer message{};
+        uint64_t frames_sent{0};
+        uint64_t stream_bytes{0};
+        uint64_t delta_bytes{0};
+        uint64_t mismatches{0};
+        Clock::duration encode_time{};
+        Clock::duration decode_time{};
+
+        for (uint64_t tick = 0; tick < GAME_TICKS; ++tick) {
+            for (SessionId id = 0; id < session_count; ++id) {
+                if (const auto event = bot_input(bots.at(id))) {
+                    pool.input(id).apply(*event);
+                }
+            }
+
+            pool.tick_all();
+
+            const auto encode_start = Clock::now();
+            for (SessionId id = 0; id < session_count; ++id) {
+                frame_sizes[id] = encoders[id].encode(pool.session(id), frames[id]);
+            }
+            const auto decode_start = Clock::now();
+            for (SessionId id = 0; id < session_count; ++id) {
+                if (frame_sizes[id] != 0 && !decoders[id].decode({frames[id].data(), frame_sizes[id]})) {
+                    ++mismatches;
+                }
+            }
+            encode_time += decode_start - encode_start;
+            decode_time += Clock::now() - decode_start;
+
+            for (SessionId id = 0; id < session_count; ++id) {
+                const game::GameSession& session = pool.session(id);
+                stream_bytes += frame_sizes[id];
+                frames_sent += frame_sizes[id] != 0 ? 1 : 0;
+                mismatches += same_view(decoders[id].view(), session) ? 0 : 1;
+                delta_bytes += net::encode_board_delta(message, session, mirrors[id], false);
+
+                if (session.Finished) {
+                    pool.destroy(id);
+                    start_session(pool, next_seed++);
+                }
+            }
+        }
+
+        const double spectator_seconds = static_cast<double>(GAME_TICKS * session_count) / game::SIM_TICK_RATE;
+        const double encodes = static_cast<double>(GAME_TICKS * session_count);
+        const auto ns_per = [encodes](Clock::duration time) {
+            return std::chrono::duration<double, std::nano>(time).count() / encodes;
+        };
+
+        PG_LOG(Info, "spectators    : {} for {} s of game time, {} frames sent", session_count, GAME_TICKS / game::SIM_TICK_RATE, frames_sent);
+        PG_LOG(Info, "stream        : {:.0f} B/s per spectator, {:.1f} B per frame", static_cast<double>(stream_bytes) / spectator_seconds, static_cast<double>(stream_bytes) / static_cast<double>(std::max<uint64_t>(frames_sent, 1)));
+        PG_LOG(Info, "board delta   : {:.0f} B/s per spectator (byte aligned)", static_cast<double>(delta_bytes) / spectator_seconds);
+        PG_LOG(Info, "full state    : {} B/s per spectator", FULL_STATE_SIZE * game::SIM_TICK_RATE);
+        PG_LOG(Info, "encode        : {:.0f} ns per session tick, {:.2f} M/s per core", ns_per(encode_time), 1.0e3 / ns_per(encode_time));
+        PG_LOG(Info, "decode        : {:.0f} ns per session tick", ns_per(decode_time));
+        PG_LOG(Info, "mismatches    : {}", mismatches);
+
+        return mismatches == 0 ? 0 : -1;
+
+    } catch (const std::exception& ex) {
+        PG_LOG(Err, "spectator benchmark failed - {}", ex.what());
+        return -1;
+    }
+}
+
+}  // namespace pill_game::bench
@@ -0,0 +1,22 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+namespace pill_game::bench {
+
+//
+// Plays 'session_count' bot games for a minute of game time, streaming each
+// one through a SpectatorEncoder and rebuilding it with a SpectatorDecoder.
+// Reports bytes per second per spectator (against sending the full state or
+// the byte aligned BoardDelta each tick) and encode throughput on one core.
+// Fails if any decoded view differs from the session it came from.
+//
+int run_spectator_benchmark(uint32_t session_count) noexcept;
+
+}  // namespace pill_game::bench
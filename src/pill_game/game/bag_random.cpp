@@ -9,33 +9,90 @@
 
 namespace pill_game {
 
-void BagRandom::reset(std::mt19937& random) noexcept {
-    m_CurrentPiece = 0;
-    std::shuffle(m_Pieces.begin(), m_Pieces.end(), random);
-}
+namespace {
+
+using Bag = std::array<uint8_t, ALL_PIECES.size()>;
 
-BoardPiece BagRandom::fetch_next(std::mt19937& random) {
-    m_CurrentPiece = (m_CurrentPiece + 1) % static_cast<int32_t>(m_Pieces.size());
-    if (m_CurrentPiece == 0) {
-        reset(random);
+//
+// Fisher-Yates from the canonical order, one below() per swap. Spelled out
+// rather than left to std::shuffle, whose algorithm differs between standard
+// libraries, so a seed deals the same pieces on every platform.
+//
+constexpr Bag shuffled_bag(uint32_t seed, uint32_t bag_index) noexcept {
+    GameRng random{seed, RNG_STREAM_BAG, bag_index * RNG_RANGE_SIZE};
+    Bag bag{};
+    for (uint8_t i = 0; i < bag.size(); ++i) {
+        bag[i] = i;
+    }
+    for (auto i = static_cast<uint32_t>(bag.size()) - 1; i > 0; --i) {
+        std::swap(bag[i], bag[random.below(i + 1)]);
     }
+    return bag;
+}
+
+// Pinned deals; if these change, every recorded replay plays a different game
+// clang-format off
+static_assert(shuffled_bag(0, 0)     == Bag{7, 5, 1, 6, 4, 2, 3, 8, 0});
+static_assert(shuffled_bag(12345, 7) == Bag{0, 2, 4, 1, 5, 3, 8, 6, 7});
+// clang-format on
+
+}  // namespace
+
+void BagRandom::reset(uint32_t seed) noexcept {
+    m_Seed = seed;
+    seek(0);
+}
+
+void BagRandom::seek(uint32_t bag_index, int32_t piece) noexcept {
+    m_NextBag = bag_index;
+    m_Head = 0;
+    m_Count = 0;
+    deal_bag();
+
+    const auto skipped = static_cast<uint8_t>(std::clamp(piece, 0, static_cast<int32_t>(BAG_SIZE) - 1));
+    m_Head = skipped;
+    m_Count = static_cast<uint8_t>(m_Count - skipped);
+    top_up();
+}
+
+void BagRandom::set_preview_depth(uint32_t depth) noexcept {
+    m_Depth = static_cast<uint8_t>(std::min(depth, MAX_PREVIEW_DEPTH));
+    top_up();
+}
+
+BoardPiece BagRandom::fetch_next() noexcept {
+    m_Head = static_cast<uint8_t>((m_Head + 1U) & RING_MASK);
+    --m_Count;
+    top_up();
     return current();
 }
 
-std::array<BoardPiece, 2> BagRandom::hints() const noexcept {
-    const auto size = static_cast<int32_t>(m_Pieces.size());
-    std::array<BoardPiece, 2> pieces{};
-    pieces.fill(EMPTY_PIECE);
+// The ring always ends on a bag boundary, so the current piece is as far
+// into its bag as the pieces dealt after it are short of a whole bag
+uint32_t BagRandom::bag_index() const noexcept {
+    return m_NextBag - ((static_cast<uint32_t>(m_Count) + BAG_SIZE - 1) / BAG_SIZE);
+}
 
-    if ((m_CurrentPiece + 1) < size) {
-        pieces[0] = m_Pieces.at(m_CurrentPiece+1);
-    }
+int32_t BagRandom::position() const noexcept {
+    return static_cast<int32_t>((BAG_SIZE - (m_Count % BAG_SIZE)) % BAG_SIZE);
+}
 
-    if ((m_CurrentPiece + 2) < size) {
-        pieces[1] = m_Pieces.at(m_CurrentPiece+2);
+void BagRandom::deal_bag() noexcept {
+    // every bag is dealt from the canonical order, never from the previous bag
+    for (const uint8_t piece : shuffled_bag(m_Seed, m_NextBag)) {
+        const uint32_t slot = (m_Head + m_Count) & RING_MASK;
+        const uint32_t shift = (slot & 1U) * 4U;
+        m_Ring[slot / 2] = static_cast<uint8_t>((m_Ring[slot / 2] & ~(0xFU << shift)) | (piece << shift));
+        ++m_Count;
     }
+    ++m_NextBag;
+}
 
-    return pieces;
+// Keeps the current piece and a full preview dealt
+void BagRandom::top_up() noexcept {
+    while (m_Count <= m_Depth) {
+        deal_bag();
+    }
 }
 
 }  // namespace pill_game
@@ -10,10 +10,37 @@
 
 namespace pill_game {
 
+// clang-format off
+constexpr uint32_t MAX_PREVIEW_DEPTH     = 64;
+constexpr uint32_t DEFAULT_PREVIEW_DEPTH = 2;  // what the game shows
+// clang-format on
+
+//
+// Deals every piece once per bag. Each bag is shuffled from its own range of
+// the seed's RNG_STREAM_BAG rather than from draws carried over from the
+// previous bag, so seek() can jump straight to any bag; the whole state is
+// the seed, the bag index and the position within it.
+//
+// Whole bags are dealt ahead into a ring of pieces so that peek() can look
+// preview_depth() pieces past the current one, across bag boundaries, with
+// every bag still shuffled once. The ring holds indices into ALL_PIECES, two
+// to a byte, to keep sessions small.
+//
 class BagRandom {
    private:
-    int32_t m_CurrentPiece{0};
-    std::array<BoardPiece, ALL_PIECES.size()> m_Pieces{ALL_PIECES};
+    static constexpr uint32_t RING_SIZE = 128;  // pieces; a preview and a bag dealt on top of it
+    static constexpr uint32_t RING_MASK = RING_SIZE - 1;
+    static constexpr auto BAG_SIZE = static_cast<uint32_t>(ALL_PIECES.size());
+
+    static_assert(MAX_PREVIEW_DEPTH + BAG_SIZE <= RING_SIZE);
+    static_assert(BAG_SIZE <= 16, "pieces are stored as 4 bit indices");
+
+    uint32_t m_Seed{0};
+    uint32_t m_NextBag{0};  // the next bag to deal onto the end of the ring
+    uint8_t m_Head{0};      // ring slot of the current piece
+    uint8_t m_Count{0};     // pieces dealt from the current one on
+    uint8_t m_Depth{DEFAULT_PREVIEW_DEPTH};
+    std::array<uint8_t, RING_SIZE / 2> m_Ring{};
 
    public:
     explicit BagRandom() noexcept = default;
@@ -26,12 +53,41 @@ class BagRandom {
     BagRandom& operator=(BagRandom&&) = default;
 
    public:
-    void reset(std::mt19937& random) noexcept;
+    // Starts over at the first piece of bag zero
+    void reset(uint32_t seed) noexcept;
+
+    // Jumps to 'piece' of bag 'bag_index' without dealing the bags before it
+    void seek(uint32_t bag_index, int32_t piece = 0) noexcept;
+
+    // How far peek() can see, up to MAX_PREVIEW_DEPTH; deals any bags that
+    // takes straight away. The pieces themselves don't depend on it.
+    void set_preview_depth(uint32_t depth) noexcept;
+    uint32_t preview_depth() const noexcept { return m_Depth; }
 
    public:
-    BoardPiece current() const noexcept { return m_Pieces.at(m_CurrentPiece); }
-    std::array<BoardPiece, 2> hints() const noexcept;
-    BoardPiece fetch_next(std::mt19937& random);
+    BoardPiece current() const noexcept { return ALL_PIECES[piece_at(m_Head)]; }
+    BoardPiece fetch_next() noexcept;
+
+    // The piece 'ahead' after current(), 1 being the next one; EMPTY_PIECE
+    // past preview_depth()
+    BoardPiece peek(uint32_t ahead) const noexcept {
+        if (ahead == 0 || ahead > m_Depth) {
+            return EMPTY_PIECE;
+        }
+        return ALL_PIECES[piece_at((m_Head + ahead) & RING_MASK)];
+    }
+
+    uint32_t seed() const noexcept { return m_Seed; }
+    uint32_t bag_index() const noexcept;
+    int32_t position() const noexcept;
+
+   private:
+    uint8_t piece_at(uint32_t slot) const noexcept {
+        return static_cast<uint8_t>((m_Ring[slot / 2] >> ((slot & 1U) * 4U)) & 0xFU);
+    }
+
+    void deal_bag() noexcept;
+    void top_up() noexcept;
 };
 
-}  // namespace pill_game
\ No newline at end of file
+}  // namespace pill_game
@@ -7,58 +7,55 @@
 #include "pill_game/pch.h"
 #include "pill_game/game/board.h"
 
+#include "pill_game/util/const_math.h"
+
 namespace pill_game {
 
-uint32_t PillGameBoard::enemy_count() const noexcept {
-    uint32_t count = 0;
-    for (const auto& entity : m_FlatGameBoard) {
-        if (entity.EntityType == ETYPE_ENEMY) {
-            ++count;
+namespace {
+
+constexpr uint32_t BOARD_COLOURS = 3;
+constexpr uint32_t BOARD_COLOUR_MASK = (1U << BOARD_COLOURS) - 1;
+
+// The colours left in each mask of allowed colours, lowest first
+struct ColourChoices {
+    uint8_t Count{0};
+    std::array<uint8_t, BOARD_COLOURS> Colours{};
+};
+
+constexpr std::array<ColourChoices, BOARD_COLOUR_MASK + 1> COLOUR_CHOICES = []() {
+    std::array<ColourChoices, BOARD_COLOUR_MASK + 1> table{};
+    for (uint32_t mask = 0; mask <= BOARD_COLOUR_MASK; ++mask) {
+        for (uint8_t colour = 0; colour < BOARD_COLOURS; ++colour) {
+            if ((mask & (1U << colour)) != 0) {
+                table.at(mask).Colours.at(table.at(mask).Count++) = colour;
+            }
         }
     }
-    return count;
-}
+    return table;
+}();
 
-bool PillGameBoard::is_game_over() const noexcept {
-    constexpr uint32_t center_column = (GAME_BOARD_WIDTH - 1) / 2;
-    constexpr uint32_t top_row = GAME_BOARD_HEIGHT - 1;
-    return this->operator()(top_row, center_column).is_solid()
-           && this->operator()(top_row, center_column + 1).is_solid();
-}
+constexpr uint8_t MIN_LEVEL = 1;
+constexpr uint8_t MAX_LEVEL = 20;
+constexpr uint32_t DIFFICULTY_COUNT = MAX_LEVEL * 4;
 
-void BoardInitParams::print_init_params() noexcept {
-    for (uint8_t row = 0; row < GAME_BOARD_HEIGHT; ++row) {
-        PG_LOG(
-            Info,
-            "  {:>3}, {:>3}, {:>3}, {:>3}",
-            MaxEntitiesPerRow.at(row),
-            EnemyChancePerRow.at(row),
-            PillChancePerRow.at(row),
-            BlockChancePerRow.at(row)
-        );
-    }
+constexpr uint32_t difficulty_index(uint8_t level, bool allow_pills, bool allow_blocks) noexcept {
+    const uint32_t clamped = std::clamp(level, MIN_LEVEL, MAX_LEVEL);
+    return ((clamped - MIN_LEVEL) * 4) + (allow_pills ? 1U : 0U) + (allow_blocks ? 2U : 0U);
 }
 
-BoardInitParams BoardInitParams::create_difficulty(
-    uint8_t level,
-    bool allow_pills,
-    bool allow_blocks
-) noexcept {
-    constexpr uint8_t min_level = 1;
-    constexpr uint8_t max_level = 20;
-    constexpr auto max_entities = static_cast<float>(GAME_BOARD_WIDTH);
-
-    BoardInitParams init_params{};
-    auto flevel = static_cast<float>(std::clamp(level, min_level, max_level));
-    auto t = flevel / static_cast<float>(max_level);
-    auto row_growth = 1.0F - std::powf(1.0F - t, 1.0F + (2.5F * t));
-
-    auto cutoff_row = static_cast<uint8_t>(
-        std::round(std::lerp(
-            4.0F,
-            static_cast<float>(GAME_BOARD_HEIGHT - 3),
-            row_growth
-        ))
+// The difficulty curve; only ever evaluated at compile time, see DIFFICULTY_TABLE
+template <size_t Width, size_t Height>
+constexpr BasicBoardInitParams<Width, Height> make_difficulty(uint8_t level, bool allow_pills, bool allow_blocks) noexcept {
+    namespace cm = const_math;
+    constexpr auto max_entities = static_cast<float>(Width);
+
+    BasicBoardInitParams<Width, Height> init_params{};
+    const auto flevel = static_cast<float>(level);
+    const float t = flevel / static_cast<float>(MAX_LEVEL);
+    const float row_growth = 1.0F - cm::pow(1.0F - t, 1.0F + (2.5F * t));
+
+    const auto cutoff_row = static_cast<uint8_t>(
+        cm::round(cm::lerp(4.0F, static_cast<float>(Height - 3), row_growth))
     );
 
     float min_entities = 2.0F;
@@ -68,33 +65,30 @@ BoardInitParams BoardInitParams::create_difficulty(
         min_entities = 3.0F;
     }
 
-    for (uint8_t row = 0; row < GAME_BOARD_HEIGHT; ++row) {
-        if (row >= cutoff_row) {
-            continue;
-        }
+    for (uint8_t row = 0; row < cutoff_row; ++row) {
         const float row_norm = static_cast<float>(row) / (static_cast<float>(cutoff_row) + 1);
         const float entity_density = std::max(
             t * t,
             1.0F - ((2.0F * row_norm - 1.0F) * (2.0F * row_norm - 1.0F))
         );
-        float entity_factor = t * entity_density;
+        const float entity_factor = t * entity_density;
 
         init_params.MaxEntitiesPerRow.at(row) = static_cast<uint8_t>(
-            std::max(min_entities, std::floorf(max_entities * entity_density))
+            std::max(min_entities, cm::floor(max_entities * entity_density))
         );
         init_params.EnemyChancePerRow.at(row) = static_cast<uint8_t>(
-            std::round(std::lerp(25.0F, 90.0F, entity_density * entity_factor))
+            cm::round(cm::lerp(25.0F, 90.0F, entity_density * entity_factor))
         );
 
         if (allow_blocks) {
             init_params.BlockChancePerRow.at(row) = static_cast<uint8_t>(
-                std::round(std::lerp(2.0F, 15.0F, entity_factor))
+                cm::round(cm::lerp(2.0F, 15.0F, entity_factor))
             );
         }
 
         if (allow_pills) {
             init_params.PillChancePerRow.at(row) = static_cast<uint8_t>(
-                std::round(std::lerp(2.0F, 20.0F, entity_factor))
+                cm::round(cm::lerp(2.0F, 20.0F, entity_factor))
             );
         }
     }
@@ -102,123 +96,263 @@ BoardInitParams BoardInitParams::create_difficulty(
     return init_params;
 }
 
-void PillGameBoard::init_board(const BoardInitParams& params, std::mt19937& rng_device) noexcept {
-    m_FlatGameBoard.fill(EMPTY_ENTITY);
+// Every level and pill/block setting, laid out as difficulty_index()
+template <size_t Width, size_t Height>
+constexpr std::array<BasicBoardInitParams<Width, Height>, DIFFICULTY_COUNT> DIFFICULTY_TABLE = []() {
+    std::array<BasicBoardInitParams<Width, Height>, DIFFICULTY_COUNT> table{};
+    for (uint8_t level = MIN_LEVEL; level <= MAX_LEVEL; ++level) {
+        for (uint32_t flags = 0; flags < 4; ++flags) {
+            const bool allow_pills = (flags & 1U) != 0;
+            const bool allow_blocks = (flags & 2U) != 0;
+            table.at(difficulty_index(level, allow_pills, allow_blocks)) = make_difficulty<Width, Height>(level, allow_pills, allow_blocks);
+        }
+    }
+    return table;
+}();
+
+// Golden rows of the curve; failing one of these changes every board of that level
+using Row = std::array<uint8_t, GAME_BOARD_HEIGHT>;
+constexpr const auto& CLASSIC_TABLE = DIFFICULTY_TABLE<GAME_BOARD_WIDTH, GAME_BOARD_HEIGHT>;
+
+// clang-format off
+static_assert(CLASSIC_TABLE[difficulty_index(1,  false, false)].MaxEntitiesPerRow == Row{2, 4, 7, 8, 7});
+static_assert(CLASSIC_TABLE[difficulty_index(1,  false, false)].EnemyChancePerRow == Row{25, 26, 28, 28, 28});
+static_assert(CLASSIC_TABLE[difficulty_index(1,  false, false)].PillChancePerRow  == Row{});
+static_assert(CLASSIC_TABLE[difficulty_index(9,  true,  true)].MaxEntitiesPerRow  == Row{3, 3, 4, 6, 7, 7, 7, 7, 6, 4});
+static_assert(CLASSIC_TABLE[difficulty_index(9,  true,  true)].EnemyChancePerRow  == Row{26, 28, 35, 43, 50, 54, 54, 50, 43, 35});
+static_assert(CLASSIC_TABLE[difficulty_index(9,  true,  true)].PillChancePerRow   == Row{4, 5, 7, 8, 9, 10, 10, 9, 8, 7});
+static_assert(CLASSIC_TABLE[difficulty_index(9,  true,  true)].BlockChancePerRow  == Row{3, 4, 5, 7, 7, 8, 8, 7, 7, 5});
+static_assert(CLASSIC_TABLE[difficulty_index(19, true,  true)].MaxEntitiesPerRow  == Row{7, 7, 7, 7, 7, 7, 7, 8, 7, 7, 7, 7, 7});
+static_assert(CLASSIC_TABLE[difficulty_index(19, true,  true)].EnemyChancePerRow  == Row{75, 75, 75, 75, 75, 77, 84, 87, 84, 77, 75, 75, 75});
+static_assert(CLASSIC_TABLE[difficulty_index(19, true,  true)].PillChancePerRow   == Row{17, 17, 17, 17, 17, 18, 19, 19, 19, 18, 17, 17, 17});
+static_assert(CLASSIC_TABLE[difficulty_index(19, true,  true)].BlockChancePerRow  == Row{13, 13, 13, 13, 13, 13, 14, 14, 14, 13, 13, 13, 13});
+static_assert(CLASSIC_TABLE[difficulty_index(20, true,  true)].MaxEntitiesPerRow  == Row{8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8});
+static_assert(CLASSIC_TABLE[difficulty_index(20, true,  true)].EnemyChancePerRow  == Row{90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90});
+static_assert(CLASSIC_TABLE[difficulty_index(20, true,  false)].BlockChancePerRow == Row{});
+// clang-format on
+
+}  // namespace
+
+template <size_t Width, size_t Height>
+void BasicPillGameBoard<Width, Height>::recompute_stats() noexcept {
+    m_Stats = Stats{};
+    m_Occupancy.fill(0);
+    for (uint32_t row = 0; row < Height; ++row) {
+        for (uint32_t col = 0; col < Width; ++col) {
+            const BoardEntity& ent = this->operator()(row, col);
+            count(ent, 1);
+            if (ent.is_solid()) {
+                m_Stats.ColumnHeights[col] = static_cast<uint8_t>(row + 1);
+                m_Occupancy[row] = static_cast<OccupancyRow>(m_Occupancy[row] | (1U << col));
+            }
+        }
+    }
+    m_Stats.StackHeight = std::ranges::max(m_Stats.ColumnHeights);
+}
 
-    auto chance_dist = std::uniform_int_distribution<int32_t>(0, 100);
-    auto colour_dist = std::uniform_int_distribution<int32_t>(0, 2);
+template <size_t Width, size_t Height>
+void BasicPillGameBoard<Width, Height>::count(BoardEntity entity, int32_t delta) noexcept {
+    const auto adjust = [delta](typename Stats::Count& value) noexcept {
+        value = static_cast<typename Stats::Count>(static_cast<int32_t>(value) + delta);
+    };
 
-    auto col_indicies = std::array<uint8_t, GAME_BOARD_WIDTH>{};
-    for (uint8_t row = 0; row < GAME_BOARD_WIDTH; ++row) {
-        col_indicies.at(row) = row;
+    switch (entity.EntityType) {
+        case ETYPE_ENEMY:
+            adjust(m_Stats.Enemies[entity.Colour]);
+            adjust(m_Stats.EnemyTotal);
+            break;
+        case ETYPE_PILL:
+        case ETYPE_SPILL:
+            adjust(m_Stats.Pills[entity.Colour]);
+            break;
+        case ETYPE_BLOCK:
+            adjust(m_Stats.Blocks[entity.Colour]);
+            break;
+        default:
+            break;
     }
+}
 
-    for (uint32_t row = 0; row < GAME_BOARD_HEIGHT; ++row) {
-        int32_t entity_count = 0;
+// Every write that goes through here keeps the stats and occupancy; the cost
+// is a few counters unless it empties the top cell of a column
+template <size_t Width, size_t Height>
+void BasicPillGameBoard<Width, Height>::set_cell(uint32_t row, uint32_t col, BoardEntity entity) noexcept {
+    BoardEntity& cell = this->operator()(row, col);
+    const bool was_solid = cell.is_solid();
+    count(cell, -1);
+    count(entity, 1);
+    cell = entity;
+
+    const auto bit = static_cast<OccupancyRow>(1U << col);
+    m_Occupancy[row] = static_cast<OccupancyRow>(entity.is_solid() ? (m_Occupancy[row] | bit) : (m_Occupancy[row] & ~bit));
+
+    uint8_t& height = m_Stats.ColumnHeights[col];
+    if (entity.is_solid()) {
+        if (row >= height) {
+            height = static_cast<uint8_t>(row + 1);
+            m_Stats.StackHeight = std::max(m_Stats.StackHeight, height);
+        }
+    } else if (was_solid && row + 1 == height) {
+        lower_column(row, col);
+    }
+}
 
-        auto max_entities = static_cast<int32_t>(params.MaxEntitiesPerRow.at(row));
-        auto enemy_chance = static_cast<int32_t>(params.EnemyChancePerRow.at(row));
-        auto pill_chance = static_cast<int32_t>(params.PillChancePerRow.at(row));
-        auto block_chance = static_cast<int32_t>(params.BlockChancePerRow.at(row));
+// The top cell of 'col' at 'row' was emptied; finds the next one down
+template <size_t Width, size_t Height>
+void BasicPillGameBoard<Width, Height>::lower_column(uint32_t row, uint32_t col) noexcept {
+    uint32_t height = row;
+    while (height > 0 && !this->operator()(height - 1, col).is_solid()) {
+        --height;
+    }
+
+    const bool was_tallest = m_Stats.ColumnHeights[col] == m_Stats.StackHeight;
+    m_Stats.ColumnHeights[col] = static_cast<uint8_t>(height);
+    if (was_tallest) {
+        m_Stats.StackHeight = std::ranges::max(m_Stats.ColumnHeights);
+    }
+}
+
+template <size_t Width, size_t Height>
+bool BasicPillGameBoard<Width, Height>::is_game_over() const noexcept {
+    return this->operator()(TOP_ROW, CENTRE).is_solid()
+           && this->operator()(TOP_ROW, CENTRE + 1).is_solid();
+}
 
-        auto etype_chances = std::array<std::tuple<int32_t, uint8_t>, 3>{
-            std::make_tuple(pill_chance, ETYPE_SPILL),
-            std::make_tuple(block_chance, ETYPE_BLOCK),
-            std::make_tuple(enemy_chance, ETYPE_ENEMY)
+template <size_t Width, size_t Height>
+void BasicBoardInitParams<Width, Height>::print_init_params() noexcept {
+    for (uint8_t row = 0; row < Height; ++row) {
+        PG_LOG(
+            Info,
+            "  {:>3}, {:>3}, {:>3}, {:>3}",
+            MaxEntitiesPerRow.at(row),
+            EnemyChancePerRow.at(row),
+            PillChancePerRow.at(row),
+            BlockChancePerRow.at(row)
+        );
+    }
+}
+
+template <size_t Width, size_t Height>
+BasicBoardInitParams<Width, Height> BasicBoardInitParams<Width, Height>::create_difficulty(
+    uint8_t level,
+    bool allow_pills,
+    bool allow_blocks
+) noexcept {
+    return DIFFICULTY_TABLE<Width, Height>[difficulty_index(level, allow_pills, allow_blocks)];
+}
+
+template <size_t Width, size_t Height>
+void BasicPillGameBoard<Width, Height>::init_board(const InitParams& params, uint32_t seed) noexcept {
+    m_FlatGameBoard.fill(EMPTY_ENTITY);
+
+    // length and colour of the run of solid cells ending just below each column
+    std::array<uint8_t, Width> run_below{};
+    std::array<uint8_t, Width> colour_below{};
+
+    const auto max_run = static_cast<uint32_t>(params.MaxConnectedColours);
+
+    for (uint32_t row = 0; row < Height; ++row) {
+        const auto max_entities = static_cast<int32_t>(params.MaxEntitiesPerRow.at(row));
+        if (max_entities == 0) {
+            run_below.fill(0);
+            continue;
+        }
+
+        GameRng rng_device{seed, RNG_STREAM_BOARD, row * RNG_RANGE_SIZE};
+        BoardEntity* cells = &m_FlatGameBoard.at(row * Width);
+        int32_t entity_count = 0;
+
+        const auto etype_chances = std::array<std::tuple<int32_t, uint8_t>, 3>{
+            std::make_tuple(static_cast<int32_t>(params.PillChancePerRow.at(row)), ETYPE_SPILL),
+            std::make_tuple(static_cast<int32_t>(params.BlockChancePerRow.at(row)), ETYPE_BLOCK),
+            std::make_tuple(static_cast<int32_t>(params.EnemyChancePerRow.at(row)), ETYPE_ENEMY)
         };
 
-        std::shuffle(col_indicies.begin(), col_indicies.end(), rng_device);
+        // each row starts from the same order so it only depends on its own draws
+        auto col_indicies = std::array<uint8_t, Width>{};
+        for (uint8_t col = 0; col < Width; ++col) {
+            col_indicies.at(col) = col;
+        }
+        DrawSplitter order{rng_device()};
+        for (auto i = static_cast<uint32_t>(Width - 1); i > 0; --i) {
+            std::swap(col_indicies[i], col_indicies[order.below(i + 1)]);
+        }
 
+        // where things go first; colours need the whole row laid out
         for (uint8_t col : col_indicies) {
             if (max_entities <= entity_count) {
                 break;
             }
 
-            std::shuffle(etype_chances.begin(), etype_chances.end(), rng_device);
-            auto val = static_cast<int32_t>(chance_dist(rng_device));
-            BoardEntity& entity = this->operator()(row, col);
-
-            for (const auto& etype_chance : etype_chances) {
-                const auto& [chance, etype] = etype_chance;
-
-                if (val > chance) {
-                    continue;
-                }
-                entity.EntityType = etype;
-                entity.Colour = colour_dist(rng_device);
-                auto max_iter = 10;  // upper bound
-
-                while (
-                    horizontal_colour_count(row, col) > params.MaxConnectedColours
-                    || vertical_colour_count(row, col) > params.MaxConnectedColours
-                           && max_iter > 0  // not sure if this is required but just to be safe
-                ) {
-                    entity.Colour = colour_dist(rng_device);
-                    --max_iter;
-                }
+            // Every type that passes the roll counts towards the row and one
+            // of them, picked at random, is placed. The rolls are coin flips
+            // to the branch predictor so the hits are counted without branches.
+            DrawSplitter draws{rng_device()};
+            const auto val = static_cast<int32_t>(draws.below(101));
+            std::array<uint8_t, 3> hits{};
+            uint32_t hit_count{0};
+            for (const auto& [chance, etype] : etype_chances) {
+                hits.at(hit_count) = etype;
+                hit_count += val <= chance ? 1 : 0;
+            }
 
-                ++entity_count;
+            entity_count += static_cast<int32_t>(hit_count);
+            if (hit_count > 0) {
+                cells[col].EntityType = hits.at(draws.below(hit_count));
             }
         }
-    }
-}
 
-bool PillGameBoard::can_piece_drop(const BoardPiece& piece) const noexcept {
-    if (piece.Row == 0) {
-        return false;
-    }
+        // Then colours, left to right. The cell to the left and the column
+        // below are final, so ruling out any colour that would extend either
+        // run past MaxConnectedColours gives a valid board in one pass.
+        DrawSplitter colours{GameRng{seed, RNG_STREAM_COLOUR, row * RNG_RANGE_SIZE}()};
+        uint32_t run_left{0};
+        uint8_t colour_left{0};
+        for (uint32_t col = 0; col < Width; ++col) {
+            BoardEntity& entity = cells[col];
+            if (entity.EntityType == ETYPE_NONE) {
+                run_left = 0;
+                run_below.at(col) = 0;
+                continue;
+            }
 
-    const auto& [l_row, l_col] = piece.left_piece_pos();
-    const auto& [r_row, r_col] = piece.right_piece_pos();
+            uint32_t allowed = BOARD_COLOUR_MASK;
+            allowed &= run_left >= max_run ? ~(1U << colour_left) : ~0U;
+            allowed &= run_below.at(col) >= max_run ? ~(1U << colour_below.at(col)) : ~0U;
+            allowed = allowed == 0 ? BOARD_COLOUR_MASK : allowed;  // only when MaxConnectedColours is 0
 
-    if (l_row == 0 || r_row == 0) {
-        return false;
-    }
+            const ColourChoices& choices = COLOUR_CHOICES.at(allowed);
+            const uint8_t colour = choices.Colours.at(colours.below(choices.Count));
+            entity.Colour = colour;
 
-    // Right piece is pointing directly down
-    if (piece.Rotation == ROTATE_SOUTH) {
-        return !this->operator()(r_row - 1, r_col).is_solid();
-    }
-
-    // Left piece is pointing directly down
-    if (piece.Rotation == ROTATE_NORTH) {
-        return !this->operator()(l_row - 1, l_col).is_solid();
+            run_left = colour_left == colour ? run_left + 1 : 1;
+            colour_left = colour;
+            run_below.at(col) = static_cast<uint8_t>(colour_below.at(col) == colour ? run_below.at(col) + 1 : 1);
+            colour_below.at(col) = colour;
+        }
     }
 
-    // check that both places are empty
-    return !this->operator()(r_row - 1, r_col).is_solid()
-           && !this->operator()(l_row - 1, l_col).is_solid();
+    recompute_stats();
 }
 
-bool PillGameBoard::can_place_piece(const BoardPiece& piece) const noexcept {
+template <size_t Width, size_t Height>
+void BasicPillGameBoard<Width, Height>::place_piece(const BoardPiece& piece) noexcept {
     const auto& [lrow, lcol] = piece.left_piece_pos();
     const auto& [rrow, rcol] = piece.right_piece_pos();
-
-    if (rcol < 0 || std::cmp_greater_equal(rcol, GAME_BOARD_WIDTH)
-        || rrow < 0 || std::cmp_greater_equal(rrow, GAME_BOARD_HEIGHT)) {
-        return false;
-    }
-
-    if (lcol < 0 || std::cmp_greater_equal(lcol, GAME_BOARD_WIDTH)
-        || lrow < 0 || std::cmp_greater_equal(lrow, GAME_BOARD_HEIGHT)) {
-        return false;
-    }
-
-    return !this->operator()(lrow, lcol).is_solid()
-           && !this->operator()(rrow, rcol).is_solid();
+    set_cell(static_cast<uint32_t>(lrow), static_cast<uint32_t>(lcol), piece.Left);
+    set_cell(static_cast<uint32_t>(rrow), static_cast<uint32_t>(rcol), piece.Right);
 }
 
-void PillGameBoard::place_piece(const BoardPiece& piece) noexcept {
-    this->operator()(piece.left_piece_pos()) = piece.Left;
-    this->operator()(piece.right_piece_pos()) = piece.Right;
-}
-
-void PillGameBoard::remove_piece(const BoardPiece& piece) noexcept {
-    this->operator()(piece.left_piece_pos()) = EMPTY_ENTITY;
-    this->operator()(piece.right_piece_pos()) = EMPTY_ENTITY;
+template <size_t Width, size_t Height>
+void BasicPillGameBoard<Width, Height>::remove_piece(const BoardPiece& piece) noexcept {
+    const auto& [lrow, lcol] = piece.left_piece_pos();
+    const auto& [rrow, rcol] = piece.right_piece_pos();
+    set_cell(static_cast<uint32_t>(lrow), static_cast<uint32_t>(lcol), EMPTY_ENTITY);
+    set_cell(static_cast<uint32_t>(rrow), static_cast<uint32_t>(rcol), EMPTY_ENTITY);
 }
 
-bool PillGameBoard::can_tick_gravity(uint32_t row, uint32_t col) const noexcept {
+template <size_t Width, size_t Height>
+bool BasicPillGameBoard<Width, Height>::can_tick_gravity(uint32_t row, uint32_t col) const noexcept {
     const BoardEntity& ent = this->operator()(row, col);
 
     // cell is empty or at the bottom of the board
@@ -244,11 +378,12 @@ bool PillGameBoard::can_tick_gravity(uint32_t row, uint32_t col) const noexcept
     return !down.is_solid() && r > 0 && !this->operator()(r - 1, c).is_solid();
 }
 
-int32_t PillGameBoard::connected_colour_count(uint32_t row, uint32_t col, bool horizontal) const noexcept {
+template <size_t Width, size_t Height>
+int32_t BasicPillGameBoard<Width, Height>::connected_colour_count(uint32_t row, uint32_t col, bool horizontal) const noexcept {
     int32_t count{0};
     auto req_colour = this->operator()(row, col).Colour;
 
-    const auto max_val = static_cast<int32_t>(horizontal ? GAME_BOARD_WIDTH : GAME_BOARD_HEIGHT);
+    const auto max_val = static_cast<int32_t>(horizontal ? Width : Height);
     const auto start_val = static_cast<int32_t>(horizontal ? col : row);
 
     for (int32_t i = (start_val + 1); i < max_val; ++i) {
@@ -286,32 +421,35 @@ int32_t PillGameBoard::connected_colour_count(uint32_t row, uint32_t col, bool h
     return count;
 }
 
-int32_t PillGameBoard::horizontal_colour_count(uint32_t row, uint32_t col) const noexcept {
+template <size_t Width, size_t Height>
+int32_t BasicPillGameBoard<Width, Height>::horizontal_colour_count(uint32_t row, uint32_t col) const noexcept {
     return connected_colour_count(row, col, true);
 }
 
-int32_t PillGameBoard::vertical_colour_count(uint32_t row, uint32_t col) const noexcept {
+template <size_t Width, size_t Height>
+int32_t BasicPillGameBoard<Width, Height>::vertical_colour_count(uint32_t row, uint32_t col) const noexcept {
     return connected_colour_count(row, col, false);
 }
 
-int32_t PillGameBoard::tick_gravity() noexcept {
+template <size_t Width, size_t Height>
+int32_t BasicPillGameBoard<Width, Height>::tick_gravity() noexcept {
     int32_t pieces_moved{0};
-    for (uint32_t row = 1; row < GAME_BOARD_HEIGHT; ++row) {
-        for (uint32_t col = 0; col < GAME_BOARD_WIDTH; ++col) {
+    for (uint32_t row = 1; row < Height; ++row) {
+        for (uint32_t col = 0; col < Width; ++col) {
             if (can_tick_gravity(row, col)) {
                 auto& cur = this->operator()(row, col);
 
                 if (cur.EntityType == ETYPE_PILL) {
                     BoardPiece piece{*this, row, col};
                     const auto&[r, c] = piece.right_piece_pos();
-                    this->operator()(row-1, col) = piece.Left;
-                    this->operator()(r-1, c) = piece.Right;
-                    this->operator()(row, col) = EMPTY_ENTITY;
-                    this->operator()(r, c) = EMPTY_ENTITY;
+                    set_cell(row - 1, col, piece.Left);
+                    set_cell(r - 1, c, piece.Right);
+                    set_cell(row, col, EMPTY_ENTITY);
+                    set_cell(r, c, EMPTY_ENTITY);
 
                 } else {
-                    this->operator()(row - 1, col) = cur;
-                    this->operator()(row, col) = EMPTY_ENTITY;
+                    set_cell(row - 1, col, cur);
+                    set_cell(row, col, EMPTY_ENTITY);
                     ++pieces_moved;
                 }
             }
@@ -320,39 +458,204 @@ int32_t PillGameBoard::tick_gravity() noexcept {
     return pieces_moved;
 }
 
-int32_t PillGameBoard::break_pieces(int32_t min_req_for_break) noexcept {
-    int32_t pieces_broken{0};
+namespace {
 
-    // clear out any previously broken entities
-    for (auto& ent : m_FlatGameBoard) {
-        if (ent.EntityType == ETYPE_BROKEN) {
-            ent = EMPTY_ENTITY;
+// The classic rule, as the game has always played: each cell counts its own
+// lines, which on boards this small is faster than any run length pass
+template <typename Board, typename Break>
+void find_matches(LineMatch, const Board& board, int32_t min_req_for_break, Break&& on_break) noexcept {
+    for (uint32_t row = 0; row < Board::HEIGHT; ++row) {
+        for (uint32_t col = 0; col < Board::WIDTH; ++col) {
+            if (
+                board(row, col).is_breakable()
+                && (board.horizontal_colour_count(row, col) >= min_req_for_break
+                    || board.vertical_colour_count(row, col) >= min_req_for_break)
+            ) {
+                on_break(row, col);
+            }
         }
     }
+}
 
-    for (uint32_t row = 0; row < GAME_BOARD_HEIGHT; ++row) {
-        for (uint32_t col = 0; col < GAME_BOARD_WIDTH; ++col) {
-            const auto& ent = this->operator()(row, col);
-            if (
-                ent.is_breakable()
-                && (horizontal_colour_count(row, col) >= min_req_for_break
-                    || vertical_colour_count(row, col) >= min_req_for_break)
-            ) {
-                if (ent.EntityType == ETYPE_PILL) {
-                    BoardPiece piece{*this, row, col};
-                    auto& r = this->operator()(piece.right_piece_pos());
-                    if (r.EntityType == ETYPE_PILL) {
-                        r.EntityType = ETYPE_SPILL;
+// Calls fn(first, stride, length) for every line of breakable cells of one
+// colour, single cells included, across the rows or up the columns
+template <typename Board, typename Fn>
+void for_each_run(const Board& board, bool horizontal, Fn&& fn) noexcept {
+    const auto& cells = board.flat_game_board();
+    const size_t lines = horizontal ? Board::HEIGHT : Board::WIDTH;
+    const size_t length = horizontal ? Board::WIDTH : Board::HEIGHT;
+    const size_t stride = horizontal ? 1 : Board::WIDTH;
+
+    for (size_t line = 0; line < lines; ++line) {
+        const size_t first = horizontal ? line * Board::WIDTH : line;
+        for (size_t i = 0; i < length;) {
+            const auto& ent = cells[first + (i * stride)];
+            size_t end = i + 1;
+            if (ent.is_breakable()) {
+                while (end < length) {
+                    const auto& next = cells[first + (end * stride)];
+                    if (!next.is_breakable() || next.Colour != ent.Colour) {
+                        break;
                     }
+                    ++end;
                 }
+                fn(first + (i * stride), stride, end - i);
+            }
+            i = end;
+        }
+    }
+}
+
+template <typename Board, typename Break>
+void break_marked(const std::array<bool, Board::SIZE>& marked, Break&& on_break) noexcept {
+    for (size_t i = 0; i < Board::SIZE; ++i) {
+        if (marked[i]) {
+            on_break(static_cast<uint32_t>(i / Board::WIDTH), static_cast<uint32_t>(i % Board::WIDTH));
+        }
+    }
+}
 
-                this->operator()(row, col).EntityType = ETYPE_BROKEN;
-                ++pieces_broken;
+// A flood fill from each cell not yet in a cluster; every cell is queued once
+template <typename Board, typename Break>
+void find_matches(ClusterMatch, const Board& board, int32_t min_req_for_break, Break&& on_break) noexcept {
+    const auto& cells = board.flat_game_board();
+    std::array<bool, Board::SIZE> seen{};
+    std::array<bool, Board::SIZE> marked{};
+    std::array<uint16_t, Board::SIZE> queue{};
+
+    for (size_t start = 0; start < Board::SIZE; ++start) {
+        if (seen[start] || !cells[start].is_breakable()) {
+            continue;
+        }
+
+        const uint8_t colour = cells[start].Colour;
+        const auto join = [&](size_t i, size_t& end) noexcept {
+            if (!seen[i] && cells[i].is_breakable() && cells[i].Colour == colour) {
+                seen[i] = true;
+                queue[end++] = static_cast<uint16_t>(i);
+            }
+        };
+
+        size_t end = 0;
+        seen[start] = true;
+        queue[end++] = static_cast<uint16_t>(start);
+        for (size_t next = 0; next < end; ++next) {
+            const size_t i = queue[next];
+            const size_t col = i % Board::WIDTH;
+            if (col > 0) {
+                join(i - 1, end);
+            }
+            if (col + 1 < Board::WIDTH) {
+                join(i + 1, end);
+            }
+            if (i >= Board::WIDTH) {
+                join(i - Board::WIDTH, end);
+            }
+            if (i + Board::WIDTH < Board::SIZE) {
+                join(i + Board::WIDTH, end);
+            }
+        }
+
+        if (end >= static_cast<size_t>(std::max(min_req_for_break, 1))) {
+            for (size_t k = 0; k < end; ++k) {
+                marked[queue[k]] = true;
+            }
+        }
+    }
+
+    break_marked<Board>(marked, on_break);
+}
+
+// Run lengths both ways first, then a line breaks if it's long enough on its
+// own or if it crosses another line where both are at least MIN_ARM long
+template <typename Board, typename Break>
+void find_matches(ShapeMatch, const Board& board, int32_t min_req_for_break, Break&& on_break) noexcept {
+    std::array<uint8_t, Board::SIZE> row_runs{};
+    std::array<uint8_t, Board::SIZE> column_runs{};
+    std::array<bool, Board::SIZE> marked{};
+
+    const auto record = [](std::array<uint8_t, Board::SIZE>& runs) noexcept {
+        return [&runs](size_t first, size_t stride, size_t length) noexcept {
+            for (size_t k = 0; k < length; ++k) {
+                runs[first + (k * stride)] = static_cast<uint8_t>(length);
+            }
+        };
+    };
+    for_each_run(board, true, record(row_runs));
+    for_each_run(board, false, record(column_runs));
+
+    const auto mark = [&](const std::array<uint8_t, Board::SIZE>& crossing) noexcept {
+        return [&](size_t first, size_t stride, size_t length) noexcept {
+            bool breaks = std::cmp_greater_equal(length, min_req_for_break);
+            if (std::cmp_greater_equal(length, ShapeMatch::MIN_ARM)) {
+                for (size_t k = 0; k < length && !breaks; ++k) {
+                    breaks = crossing[first + (k * stride)] >= ShapeMatch::MIN_ARM;
+                }
             }
+            for (size_t k = 0; breaks && k < length; ++k) {
+                marked[first + (k * stride)] = true;
+            }
+        };
+    };
+    for_each_run(board, true, mark(column_runs));
+    for_each_run(board, false, mark(row_runs));
+
+    break_marked<Board>(marked, on_break);
+}
+
+}  // namespace
+
+template <size_t Width, size_t Height>
+template <typename Rule>
+int32_t BasicPillGameBoard<Width, Height>::break_pieces(int32_t min_req_for_break) noexcept {
+    int32_t pieces_broken{0};
+
+    // clear out any previously broken entities; the stats already left them out
+    for (auto& ent : m_FlatGameBoard) {
+        if (ent.EntityType == ETYPE_BROKEN) {
+            ent = EMPTY_ENTITY;
         }
     }
 
+    // Broken cells keep their colour and stay breakable, so breaking as the
+    // line rule scans doesn't change what it finds further on
+    find_matches(Rule{}, *this, min_req_for_break, [this, &pieces_broken](uint32_t row, uint32_t col) noexcept {
+        const auto& ent = this->operator()(row, col);
+        if (ent.EntityType == ETYPE_PILL) {
+            BoardPiece piece{*this, row, col};
+            auto& r = this->operator()(piece.right_piece_pos());
+            if (r.EntityType == ETYPE_PILL) {
+                r.EntityType = ETYPE_SPILL;
+                r.Rotation = ROTATE_NORTH;  // only whole pills are rotated; see packed_board.h
+            }
+        }
+
+        set_cell(row, col, BoardEntity{ent.Colour, ETYPE_BROKEN, ROTATE_NORTH});
+        ++pieces_broken;
+    });
+
     return pieces_broken;
 }
 
+// clang-format off
+template struct BasicBoardInitParams<GAME_BOARD_WIDTH, GAME_BOARD_HEIGHT>;
+template struct BasicBoardInitParams<SPRINT_BOARD_WIDTH, SPRINT_BOARD_HEIGHT>;
+template struct BasicBoardInitParams<MARATHON_BOARD_WIDTH, MARATHON_BOARD_HEIGHT>;
+
+template class BasicPillGameBoard<GAME_BOARD_WIDTH, GAME_BOARD_HEIGHT>;
+template class BasicPillGameBoard<SPRINT_BOARD_WIDTH, SPRINT_BOARD_HEIGHT>;
+template class BasicPillGameBoard<MARATHON_BOARD_WIDTH, MARATHON_BOARD_HEIGHT>;
+
+#define PG_INSTANTIATE_MATCH_RULE(Board)                                          \
+    template int32_t Board::break_pieces<LineMatch>(int32_t) noexcept;            \
+    template int32_t Board::break_pieces<ClusterMatch>(int32_t) noexcept;         \
+    template int32_t Board::break_pieces<ShapeMatch>(int32_t) noexcept;
+
+PG_INSTANTIATE_MATCH_RULE(PillGameBoard)
+PG_INSTANTIATE_MATCH_RULE(SprintBoard)
+PG_INSTANTIATE_MATCH_RULE(MarathonBoard)
+
+#undef PG_INSTANTIATE_MATCH_RULE
+// clang-format on
+
 }  // namespace pill_game
\ No newline at end of file
@@ -8,57 +8,147 @@
 
 #include "pill_game/pch.h"
 
+#include "pill_game/game/match_rules.h"
+#include "pill_game/game/piece_moves.h"
+
 namespace pill_game {
 
 // NOTE
 //  Arrays are Bottom to Top, that is, (0,0) is the Bottom Left
 //
 
-struct BoardInitParams {
-    std::array<uint8_t, GAME_BOARD_HEIGHT> MaxEntitiesPerRow{0};
-    std::array<uint8_t, GAME_BOARD_HEIGHT> EnemyChancePerRow{0};
-    std::array<uint8_t, GAME_BOARD_HEIGHT> PillChancePerRow{0};
-    std::array<uint8_t, GAME_BOARD_HEIGHT> BlockChancePerRow{0};
+template <size_t Width, size_t Height>
+struct BasicBoardInitParams {
+    std::array<uint8_t, Height> MaxEntitiesPerRow{0};
+    std::array<uint8_t, Height> EnemyChancePerRow{0};
+    std::array<uint8_t, Height> PillChancePerRow{0};
+    std::array<uint8_t, Height> BlockChancePerRow{0};
     uint8_t MaxConnectedColours{2};
 
     void print_init_params() noexcept;
 
-    static BoardInitParams create_difficulty(
+    // A copy out of a table built at compile time for levels 1 - 20; other
+    // levels are clamped into that range
+    static BasicBoardInitParams create_difficulty(
         uint8_t level,
         bool allow_pills,
         bool allow_blocks
     ) noexcept;
 };
 
-class PillGameBoard {
+// clang-format off
+constexpr size_t BOARD_STAT_COLOURS = 8;  // every value BoardEntity::Colour can hold
+// clang-format on
+
+//
+// Running totals for a board, kept up to date by every board operation that
+// writes cells so the HUD, bots and the session's win test never scan for
+// them. Broken cells are gone as far as these are concerned.
+//
+template <size_t Width, size_t Height>
+struct BasicBoardStats {
+    using Count = std::conditional_t<(Width * Height) <= std::numeric_limits<uint8_t>::max(), uint8_t, uint16_t>;
+
+    std::array<Count, BOARD_STAT_COLOURS> Enemies{};
+    std::array<Count, BOARD_STAT_COLOURS> Pills{};  // halves, whole or single
+    std::array<Count, BOARD_STAT_COLOURS> Blocks{};
+    Count EnemyTotal{0};
+    uint8_t StackHeight{0};                      // of the tallest column
+    std::array<uint8_t, Width> ColumnHeights{};  // one past the top solid cell, 0 when empty
+
+    bool operator==(const BasicBoardStats&) const noexcept = default;
+};
+
+//
+// Board dimensions are template parameters so that every loop bound, index
+// and bounds test is a constant; each mode gets its own fully specialised
+// code and the hot path never asks how big the board is. Only the sizes
+// instantiated in board.cpp exist (see the aliases below).
+//
+template <size_t Width, size_t Height>
+class BasicPillGameBoard {
+    static_assert(Width >= 6 && Width < std::numeric_limits<uint8_t>::max());
+    static_assert(Height >= 8 && Height < std::numeric_limits<uint8_t>::max());
+    static_assert(Width <= 32, "occupancy rows are at most 32 bits");
+
+   public:
+    // clang-format off
+    static constexpr size_t WIDTH   = Width;
+    static constexpr size_t HEIGHT  = Height;
+    static constexpr size_t SIZE    = Width * Height;
+    static constexpr size_t TOP_ROW = Height - 1;
+    static constexpr size_t CENTRE  = (Width - 1) / 2;
+    // clang-format on
+
+    using InitParams = BasicBoardInitParams<Width, Height>;
+    using Stats = BasicBoardStats<Width, Height>;
+    using OccupancyRow = std::conditional_t<(Width <= 16), uint16_t, uint32_t>;
+    using Occupancy = std::array<OccupancyRow, Height>;
+
    private:
-    std::array<BoardEntity, GAME_BOARD_SIZE> m_FlatGameBoard{EMPTY_ENTITY};
+    std::array<BoardEntity, SIZE> m_FlatGameBoard{EMPTY_ENTITY};
+    Stats m_Stats{};
+    Occupancy m_Occupancy{};  // a bit per solid cell, column 0 lowest
 
    public:
-    explicit PillGameBoard() noexcept = default;
-    ~PillGameBoard() noexcept = default;
+    explicit BasicPillGameBoard() noexcept = default;
+    ~BasicPillGameBoard() noexcept = default;
 
    public:
-    PillGameBoard(const PillGameBoard&) noexcept = default;
-    PillGameBoard(PillGameBoard&&) noexcept = default;
-    PillGameBoard& operator=(const PillGameBoard&) noexcept = default;
-    PillGameBoard& operator=(PillGameBoard&&) noexcept = default;
+    BasicPillGameBoard(const BasicPillGameBoard&) noexcept = default;
+    BasicPillGameBoard(BasicPillGameBoard&&) noexcept = default;
+    BasicPillGameBoard& operator=(const BasicPillGameBoard&) noexcept = default;
+    BasicPillGameBoard& operator=(BasicPillGameBoard&&) noexcept = default;
 
    public:
     const auto& flat_game_board() const noexcept { return m_FlatGameBoard; }
+
+    // Writes through here or the mutable operator() skip the stats; call
+    // recompute_stats() once done
     auto& flat_game_board() noexcept { return m_FlatGameBoard; }
 
+    // 'piece' moved to where new pieces enter this board
+    static constexpr BoardPiece spawned(BoardPiece piece) noexcept {
+        piece.Row = static_cast<int8_t>(TOP_ROW);
+        piece.Column = static_cast<int8_t>(CENTRE);
+        return piece;
+    }
+
    public:
-    void init_board(const BoardInitParams& params, std::mt19937& rng) noexcept;
+    // Every row and cell draws from its own range of the seed's streams
+    void init_board(const InitParams& params, uint32_t seed) noexcept;
 
    public:
-    uint32_t enemy_count() const noexcept;
+    const Stats& stats() const noexcept { return m_Stats; }
+    uint32_t enemy_count() const noexcept { return m_Stats.EnemyTotal; }
     bool is_game_over() const noexcept;
 
+    // One pass over the board, for after cells were written directly; the
+    // occupancy bits are rebuilt along with the stats
+    void recompute_stats() noexcept;
+
+    // For writers that work both out alongside the cells (unpack_board); they
+    // must be what recompute_stats() would give
+    void set_stats(const Stats& stats, const Occupancy& occupancy) noexcept {
+        m_Stats = stats;
+        m_Occupancy = occupancy;
+    }
+
+    // Whether every cell 'move' needs is free, for moves from piece_move()
+    bool fits(const PieceMove& move) const noexcept {
+        const uint32_t lower = (static_cast<uint32_t>(m_Occupancy[move.MaskRow]) >> move.MaskColumn) & move.Lower;
+        const uint32_t upper = (static_cast<uint32_t>(m_Occupancy[move.MaskRow + 1U]) >> move.MaskColumn) & move.Upper;
+        return move.InBounds && (lower | upper) == 0;
+    }
+
    public:
     // Checks to see if the given piece can drop to the next row
-    bool can_piece_drop(const BoardPiece& piece) const noexcept;
-    bool can_place_piece(const BoardPiece& piece) const noexcept;
+    bool can_piece_drop(const BoardPiece& piece) const noexcept {
+        return fits(piece_move<Width, Height>(piece, PieceAction::Drop));
+    }
+    bool can_place_piece(const BoardPiece& piece) const noexcept {
+        return fits(piece_move<Width, Height>(piece, PieceAction::Hold));
+    }
     void place_piece(const BoardPiece& piece) noexcept;
     void remove_piece(const BoardPiece& piece) noexcept;
     bool can_tick_gravity(uint32_t row, uint32_t col) const noexcept;
@@ -68,14 +158,21 @@ class PillGameBoard {
     int32_t vertical_colour_count(uint32_t row, uint32_t col) const noexcept;
 
     int32_t tick_gravity() noexcept;
+
+    // Breaks whatever 'Rule' matches (see match_rules.h); instantiated in
+    // board.cpp for every rule and board size
+    template <typename Rule = LineMatch>
     int32_t break_pieces(int32_t min_req_for_break = 4) noexcept;
 
    public:
-    const BoardEntity& operator()(uint32_t row, uint32_t col) const {
-        return m_FlatGameBoard.at((row * GAME_BOARD_WIDTH) + col);
+    // Callers keep to the board; can_place_piece() is the bounds test
+    const BoardEntity& operator()(uint32_t row, uint32_t col) const noexcept {
+        assert(row < Height && col < Width);
+        return m_FlatGameBoard[(row * Width) + col];
     }
-    BoardEntity& operator()(uint32_t row, uint32_t col) {
-        return m_FlatGameBoard.at((row * GAME_BOARD_WIDTH) + col);
+    BoardEntity& operator()(uint32_t row, uint32_t col) noexcept {
+        assert(row < Height && col < Width);
+        return m_FlatGameBoard[(row * Width) + col];
     }
 
     const BoardEntity& operator()(const std::tuple<uint8_t, uint8_t>& pos) const noexcept {
@@ -91,6 +188,29 @@ class PillGameBoard {
             static_cast<uint32_t>(std::get<1>(pos))
         );
     }
+
+   private:
+    void set_cell(uint32_t row, uint32_t col, BoardEntity entity) noexcept;
+    void count(BoardEntity entity, int32_t delta) noexcept;
+    void lower_column(uint32_t row, uint32_t col) noexcept;
 };
 
+// clang-format off
+using BoardInitParams         = BasicBoardInitParams<GAME_BOARD_WIDTH, GAME_BOARD_HEIGHT>;
+using SprintBoardInitParams   = BasicBoardInitParams<SPRINT_BOARD_WIDTH, SPRINT_BOARD_HEIGHT>;
+using MarathonBoardInitParams = BasicBoardInitParams<MARATHON_BOARD_WIDTH, MARATHON_BOARD_HEIGHT>;
+
+using PillGameBoard = BasicPillGameBoard<GAME_BOARD_WIDTH, GAME_BOARD_HEIGHT>;
+using SprintBoard   = BasicPillGameBoard<SPRINT_BOARD_WIDTH, SPRINT_BOARD_HEIGHT>;
+using MarathonBoard = BasicPillGameBoard<MARATHON_BOARD_WIDTH, MARATHON_BOARD_HEIGHT>;
+
+extern template struct BasicBoardInitParams<GAME_BOARD_WIDTH, GAME_BOARD_HEIGHT>;
+extern template struct BasicBoardInitParams<SPRINT_BOARD_WIDTH, SPRINT_BOARD_HEIGHT>;
+extern template struct BasicBoardInitParams<MARATHON_BOARD_WIDTH, MARATHON_BOARD_HEIGHT>;
+
+extern template class BasicPillGameBoard<GAME_BOARD_WIDTH, GAME_BOARD_HEIGHT>;
+extern template class BasicPillGameBoard<SPRINT_BOARD_WIDTH, SPRINT_BOARD_HEIGHT>;
+extern template class BasicPillGameBoard<MARATHON_BOARD_WIDTH, MARATHON_BOARD_HEIGHT>;
+// clang-format on
+
 }  // namespace pill_game
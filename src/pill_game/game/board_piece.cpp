@@ -10,22 +10,6 @@
 
 namespace pill_game {
 
-namespace {
-
-uint8_t opposite_rotation(uint8_t rotate) {
-    // clang-format off
-    switch (rotate) {
-        case ROTATE_NORTH: return ROTATE_SOUTH; break;
-        case ROTATE_SOUTH: return ROTATE_NORTH; break;
-        case ROTATE_EAST:  return ROTATE_WEST;  break;
-        case ROTATE_WEST:  return ROTATE_EAST;  break;
-    }
-    // clang-format on
-    return rotate;
-}
-
-}  // namespace
-
 BoardPiece::BoardPiece()
     : Left(PILL_RED_E),
       Right(PILL_CYAN_W),
@@ -34,8 +18,9 @@ BoardPiece::BoardPiece()
       Column(GAME_BOARD_CENTRE) {
 }
 
+template <size_t Width, size_t Height>
 BoardPiece::BoardPiece(
-    const PillGameBoard& board,
+    const BasicPillGameBoard<Width, Height>& board,
     uint32_t row,
     uint32_t col
 ) noexcept
@@ -50,124 +35,82 @@ std::tuple<int8_t, int8_t> BoardPiece::left_piece_pos() const noexcept {
 }
 
 std::tuple<int8_t, int8_t> BoardPiece::right_piece_pos() const noexcept {
-    int8_t row{static_cast<int8_t>(Row)};
-    int8_t col{static_cast<int8_t>(Column)};
-
-    // clang-format off
-    switch (Rotation) {
-        case ROTATE_NORTH: row += 1; break;
-        case ROTATE_SOUTH: row -= 1; break;
-        case ROTATE_EAST : col += 1; break;
-        case ROTATE_WEST : col -= 1; break;
-    }
-    // clang-format on
-
-    return std::make_tuple(row, col);
+    const auto& offset = RIGHT_HALF_OFFSET[Rotation & 3U];
+    return std::make_tuple(static_cast<int8_t>(Row + offset[0]), static_cast<int8_t>(Column + offset[1]));
 }
 
-void BoardPiece::move_left(const PillGameBoard& board) noexcept {
-    if (!board.can_place_piece(*this) || Column <= 0) {
-        return;
-    }
+// Every move is a table lookup and a test of the board's occupancy bits; a
+// piece that doesn't fit where it is can't go anywhere
 
-    --Column;
-    if (!board.can_place_piece(*this)) {
-        ++Column;
-    }
-}
-
-void BoardPiece::move_right(const PillGameBoard& board) noexcept {
-    if (!board.can_place_piece(*this) || std::cmp_greater_equal(Column, GAME_BOARD_WIDTH)) {
-        return;
-    }
-
-    ++Column;
-    if (!board.can_place_piece(*this)) {
+template <size_t Width, size_t Height>
+void BoardPiece::move_left(const BasicPillGameBoard<Width, Height>& board) noexcept {
+    if (board.can_place_piece(*this) && board.fits(piece_move<Width, Height>(*this, PieceAction::Left))) {
         --Column;
     }
 }
 
-void BoardPiece::rotate_piece_clockwise(const PillGameBoard& board) noexcept {
-    if (!board.can_place_piece(*this)) {
-        return;
-    }
-
-    BoardPiece p{*this};
-    p.rotate_piece(true);
-
-    if (!board.can_place_piece(p)) {
-        p.shift_piece();
+template <size_t Width, size_t Height>
+void BoardPiece::move_right(const BasicPillGameBoard<Width, Height>& board) noexcept {
+    if (board.can_place_piece(*this) && board.fits(piece_move<Width, Height>(*this, PieceAction::Right))) {
+        ++Column;
     }
+}
 
-    if (!board.can_place_piece(p)) {
-        return;
-    }
+template <size_t Width, size_t Height>
+void BoardPiece::rotate_piece_clockwise(const BasicPillGameBoard<Width, Height>& board) noexcept {
+    rotate_on(board, PieceAction::Clockwise, PieceAction::ClockwiseKick);
+}
 
-    p.Left.Rotation = p.Rotation;
-    p.Right.Rotation = opposite_rotation(p.Rotation);
-    *this = p;
+template <size_t Width, size_t Height>
+void BoardPiece::rotate_piece_counter_clockwise(const BasicPillGameBoard<Width, Height>& board) noexcept {
+    rotate_on(board, PieceAction::CounterClockwise, PieceAction::CounterClockwiseKick);
 }
 
-void BoardPiece::rotate_piece_counter_clockwise(const PillGameBoard& board) noexcept {
+template <size_t Width, size_t Height>
+void BoardPiece::rotate_on(const BasicPillGameBoard<Width, Height>& board, PieceAction turn, PieceAction kick) noexcept {
     if (!board.can_place_piece(*this)) {
         return;
     }
 
-    BoardPiece p{*this};
-    p.rotate_piece(false);
-
-    if (!board.can_place_piece(p)) {
-        p.shift_piece();
+    const PieceMove* move = &piece_move<Width, Height>(*this, turn);
+    if (!board.fits(*move)) {
+        move = &piece_move<Width, Height>(*this, kick);
     }
 
-    if (!board.can_place_piece(p)) {
+    if (!board.fits(*move)) {
         return;
     }
 
-    p.Left.Rotation = p.Rotation;
-    p.Right.Rotation = opposite_rotation(p.Rotation);
-    *this = p;
+    Row = move->Row;
+    Column = move->Column;
+    Rotation = move->Rotation;
+    Left.Rotation = Rotation;
+    Right.Rotation = OPPOSITE_ROTATION[Rotation];
 }
 
 void BoardPiece::rotate_piece(bool clockwise) noexcept {
-
-    if (clockwise) {
-        Rotation = (Rotation + 1U) % 4U;
-        return;
-    }
-
-    if (Rotation == 0) {
-        Rotation = 3;
-    } else {
-        Rotation--;
-    }
+    Rotation = rotated(Rotation & 3U, clockwise);
 }
 
 void BoardPiece::shift_piece() noexcept {
-    int8_t row_shift{0};
-    int8_t col_shift{0};
-
-    //
-    // X X X    X X X    X X X    G X X    X X X
-    // R G X -> R X X -> G R X -> R X X -> R G X
-    // X X X    G X X    X X X    X X X    X X X
-    //
-    // R G X    R X X    G R X    X G X    R G X
-    // X X X -> G X X -> X X X -> X R X -> X X X
-    // X X X    X X X    X X X    X X X    X X X
-    //
-
-    // clang-format off
-    switch (Rotation) {
-        case ROTATE_NORTH: row_shift = {-1}; break;
-        case ROTATE_SOUTH: row_shift = {+1}; break;
-        case ROTATE_EAST : col_shift = {-1}; break;
-        case ROTATE_WEST : col_shift = {+1}; break;
-    }
-    // clang-format on
-
-    Row = static_cast<int8_t>(Row + row_shift);
-    Column = static_cast<int8_t>(Column + col_shift);
+    const auto& offset = KICK_OFFSET[Rotation & 3U];
+    Row = static_cast<int8_t>(Row + offset[0]);
+    Column = static_cast<int8_t>(Column + offset[1]);
 }
 
+// clang-format off
+#define PG_INSTANTIATE_BOARD_PIECE(Board)                                                   \
+    template BoardPiece::BoardPiece(const Board& board, uint32_t row, uint32_t col) noexcept; \
+    template void BoardPiece::move_left(const Board& board) noexcept;                         \
+    template void BoardPiece::move_right(const Board& board) noexcept;                        \
+    template void BoardPiece::rotate_piece_clockwise(const Board& board) noexcept;            \
+    template void BoardPiece::rotate_piece_counter_clockwise(const Board& board) noexcept;
+
+PG_INSTANTIATE_BOARD_PIECE(PillGameBoard)
+PG_INSTANTIATE_BOARD_PIECE(SprintBoard)
+PG_INSTANTIATE_BOARD_PIECE(MarathonBoard)
+
+#undef PG_INSTANTIATE_BOARD_PIECE
+// clang-format on
+
 }  // namespace pill_game
\ No newline at end of file
@@ -5,6 +5,7 @@
 //
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <tuple>
 
@@ -12,10 +13,19 @@
 
 namespace pill_game {
 
-class PillGameBoard;
+template <size_t Width, size_t Height>
+class BasicPillGameBoard;
+
+enum class PieceAction : uint8_t;
 
 using std::uint8_t;
 
+//
+// A piece is the same few bytes on any board, so only the moves that look at
+// a board are templates, on that board's dimensions. They're instantiated in
+// board_piece.cpp for every board size board.cpp instantiates.
+//
+
 struct BoardPiece {
     BoardEntity Left{};
     BoardEntity Right{};
@@ -34,17 +44,27 @@ struct BoardPiece {
     ) noexcept
         : Left{left}, Right{right}, Rotation{rotation}, Row{row}, Column(column) {};
 
-    BoardPiece(const PillGameBoard& board, uint32_t row, uint32_t col) noexcept;
+    template <size_t Width, size_t Height>
+    BoardPiece(const BasicPillGameBoard<Width, Height>& board, uint32_t row, uint32_t col) noexcept;
 
     std::tuple<int8_t, int8_t> left_piece_pos() const noexcept;
     std::tuple<int8_t, int8_t> right_piece_pos() const noexcept;
 
-    void move_left(const PillGameBoard& board) noexcept;
-    void move_right(const PillGameBoard& board) noexcept;
-    void rotate_piece_clockwise(const PillGameBoard& board) noexcept;
-    void rotate_piece_counter_clockwise(const PillGameBoard& board) noexcept;
+    template <size_t Width, size_t Height>
+    void move_left(const BasicPillGameBoard<Width, Height>& board) noexcept;
+    template <size_t Width, size_t Height>
+    void move_right(const BasicPillGameBoard<Width, Height>& board) noexcept;
+    template <size_t Width, size_t Height>
+    void rotate_piece_clockwise(const BasicPillGameBoard<Width, Height>& board) noexcept;
+    template <size_t Width, size_t Height>
+    void rotate_piece_counter_clockwise(const BasicPillGameBoard<Width, Height>& board) noexcept;
     void rotate_piece(bool clockwise) noexcept;
     void shift_piece() noexcept;
+
+   private:
+    // 'turn' if the piece fits after it, otherwise 'kick' if that fits
+    template <size_t Width, size_t Height>
+    void rotate_on(const BasicPillGameBoard<Width, Height>& board, PieceAction turn, PieceAction kick) noexcept;
 };
 
 }  // namespace pill_game
@@ -0,0 +1,328 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/game/dynamic_board.h"
+
+namespace pill_game {
+
+namespace {
+
+constexpr uint32_t BITS_PER_WORD = 64;
+
+// Where the other half of the full pill at (row, col) is; may be off the board
+std::tuple<int64_t, int64_t> partner_of(BoardEntity pill, uint32_t row, uint32_t col) noexcept {
+    auto partner_row = static_cast<int64_t>(row);
+    auto partner_col = static_cast<int64_t>(col);
+
+    // clang-format off
+    switch (pill.Rotation) {
+        case ROTATE_NORTH: partner_row += 1; break;
+        case ROTATE_SOUTH: partner_row -= 1; break;
+        case ROTATE_EAST : partner_col += 1; break;
+        case ROTATE_WEST : partner_col -= 1; break;
+    }
+    // clang-format on
+
+    return std::make_tuple(partner_row, partner_col);
+}
+
+// BoardEntity's tests, inlined for the per cell passes
+constexpr bool is_breakable(BoardEntity ent) noexcept {
+    return ent.EntityType == ETYPE_ENEMY || ent.EntityType == ETYPE_BLOCK || ent.EntityType >= ETYPE_PILL;
+}
+
+constexpr bool is_solid(BoardEntity ent) noexcept {
+    return ent.EntityType != ETYPE_NONE && ent.EntityType != ETYPE_BROKEN;
+}
+
+constexpr bool has_gravity(BoardEntity ent) noexcept {
+    return ent.EntityType == ETYPE_PILL || ent.EntityType == ETYPE_SPILL || ent.EntityType == ETYPE_BLOCK;
+}
+
+// Runs are counted up to here; longer ones still break
+constexpr int32_t RUN_SATURATED = std::numeric_limits<uint8_t>::max();
+
+// Cells with equal non zero keys are part of the same run. A table over the
+// type and colour bits, as the three way type test would branch on every cell
+constexpr std::array<uint8_t, 64> RUN_KEYS = []() {
+    std::array<uint8_t, 64> table{};
+    for (uint8_t type = 0; type < 8; ++type) {
+        for (uint8_t colour = 0; colour < 8; ++colour) {
+            const BoardEntity ent{colour, type, 0};
+            table.at((type * 8U) + colour) = is_breakable(ent) ? static_cast<uint8_t>(colour + 1) : 0;
+        }
+    }
+    return table;
+}();
+
+uint8_t run_key(BoardEntity ent) noexcept {
+    return RUN_KEYS[(ent.EntityType * 8U) + ent.Colour];
+}
+
+// 1 if 'key' carries on the run ending in 'prev', as a mask for the sweeps
+constexpr uint8_t joins(uint8_t key, uint8_t prev) noexcept {
+    return static_cast<uint8_t>((key == prev) & (key != 0));
+}
+
+constexpr uint8_t saturating_next(uint8_t run) noexcept {
+    return run < RUN_SATURATED ? static_cast<uint8_t>(run + 1) : run;
+}
+
+}  // namespace
+
+DynamicPillGameBoard::DynamicPillGameBoard(uint32_t width, uint32_t height)
+    : m_Width(width),
+      m_Height(height) {
+    if (width < DYNAMIC_BOARD_MIN_SIZE || width > DYNAMIC_BOARD_MAX_SIZE
+        || height < DYNAMIC_BOARD_MIN_SIZE || height > DYNAMIC_BOARD_MAX_SIZE) {
+        throw std::runtime_error{std::format(
+            "Board size {}x{} is outside {}..{}",
+            width,
+            height,
+            DYNAMIC_BOARD_MIN_SIZE,
+            DYNAMIC_BOARD_MAX_SIZE
+        )};
+    }
+
+    const size_t size = static_cast<size_t>(width) * height;
+    m_Cells.assign(size, EMPTY_ENTITY);
+    m_UnsettledFrom.assign(width, height);
+    m_Unsettled.assign((width + BITS_PER_WORD - 1) / BITS_PER_WORD, 0);
+    m_Landed.assign(width, height);
+    m_RunKeys.assign(size, 0);
+    m_RowRuns.assign(size, 0);
+    m_ColumnRuns.assign(size, 0);
+}
+
+void DynamicPillGameBoard::set(uint32_t row, uint32_t col, BoardEntity entity) noexcept {
+    at(row, col) = entity;
+    unsettle(row, col);
+}
+
+void DynamicPillGameBoard::fill_random(uint32_t seed, uint32_t fill_percent) noexcept {
+    GameRng rng{seed, RNG_STREAM_BOARD};
+    for (BoardEntity& cell : m_Cells) {
+        DrawSplitter draws{rng()};
+        cell = EMPTY_ENTITY;
+        if (draws.below(100) >= fill_percent) {
+            continue;
+        }
+
+        // mostly enemies, as on a real board
+        const uint32_t kind = draws.below(8);
+        cell.EntityType = kind < 5 ? ETYPE_ENEMY : (kind == 5 ? ETYPE_BLOCK : ETYPE_SPILL);
+        cell.Colour = static_cast<uint8_t>(draws.below(3));
+    }
+
+    for (uint32_t col = 0; col < m_Width; ++col) {
+        unsettle(0, col);
+    }
+}
+
+uint32_t DynamicPillGameBoard::enemy_count() const noexcept {
+    uint32_t count{0};
+    for (const BoardEntity& cell : m_Cells) {
+        count += cell.EntityType == ETYPE_ENEMY ? 1 : 0;
+    }
+    return count;
+}
+
+bool DynamicPillGameBoard::is_settled() const noexcept {
+    return std::ranges::all_of(m_Unsettled, [](uint64_t word) { return word == 0; });
+}
+
+void DynamicPillGameBoard::unsettle(uint32_t row, uint32_t col) noexcept {
+    // A half of a side by side pill rests on the cell below its other half,
+    // which may hold anything once the pill has been split, so both
+    // neighbouring columns are looked at again too
+    const uint32_t first = col > 0 ? col - 1 : col;
+    const uint32_t last = std::min(col + 1, m_Width - 1);
+    for (uint32_t c = first; c <= last; ++c) {
+        m_UnsettledFrom[c] = std::min(m_UnsettledFrom[c], row);
+        m_Unsettled[c / BITS_PER_WORD] |= 1ULL << (c % BITS_PER_WORD);
+    }
+}
+
+bool DynamicPillGameBoard::can_fall(uint32_t row, uint32_t col) const noexcept {
+    const BoardEntity& ent = (*this)(row, col);
+    if (row == 0 || !has_gravity(ent) || is_solid((*this)(row - 1, col))) {
+        return false;
+    }
+
+    if (ent.EntityType != ETYPE_PILL || ent.Rotation == ROTATE_NORTH) {
+        return true;
+    }
+
+    // a side by side pill needs room under both halves; the top half of an
+    // upright pill (ROTATE_SOUTH) never falls by itself
+    const auto [partner_row, partner_col] = partner_of(ent, row, col);
+    if (partner_col < 0 || partner_col >= m_Width || partner_row < 1 || partner_row >= m_Height) {
+        return false;
+    }
+    return !is_solid((*this)(static_cast<uint32_t>(partner_row - 1), static_cast<uint32_t>(partner_col)));
+}
+
+int32_t DynamicPillGameBoard::fall(uint32_t row, uint32_t col) noexcept {
+    const BoardEntity ent = at(row, col);
+    at(row - 1, col) = ent;
+    at(row, col) = EMPTY_ENTITY;
+    m_Landed[col] = std::min(m_Landed[col], row - 1);
+    unsettle(row, col);
+
+    if (ent.EntityType != ETYPE_PILL || ent.Rotation == ROTATE_SOUTH) {
+        return 1;
+    }
+
+    // As on the fixed boards, an upright pill's bottom half drops and its top
+    // half is lost, and full pills don't count as moved
+    if (ent.Rotation == ROTATE_NORTH) {
+        if (row + 1 < m_Height) {
+            at(row + 1, col) = EMPTY_ENTITY;
+            unsettle(row + 1, col);
+        }
+        return 0;
+    }
+
+    // the other half moves with it, and its column has to be swept from here on
+    const auto partner_col = static_cast<uint32_t>(std::get<1>(partner_of(ent, row, col)));
+    at(row - 1, partner_col) = at(row, partner_col);
+    at(row, partner_col) = EMPTY_ENTITY;
+    m_Landed[partner_col] = std::min(m_Landed[partner_col], row - 1);
+    unsettle(row, partner_col);
+    return 0;
+}
+
+int32_t DynamicPillGameBoard::tick_gravity() noexcept {
+    if (is_settled()) {
+        return 0;
+    }
+
+    uint32_t first_row{m_Height};
+    for (uint32_t col = 0; col < m_Width; ++col) {
+        first_row = std::min(first_row, m_UnsettledFrom[col]);
+    }
+
+    // Bottom up and left to right like the fixed boards, so anything that
+    // falls into a gap lets whatever is above it fall in the same tick
+    int32_t moved{0};
+    for (uint32_t row = std::max(first_row, 1U); row < m_Height; ++row) {
+        for (size_t word = 0; word < m_Unsettled.size(); ++word) {
+            for (uint64_t bits = m_Unsettled[word]; bits != 0; bits &= bits - 1) {
+                const auto col = static_cast<uint32_t>((word * BITS_PER_WORD) + std::countr_zero(bits));
+                if (m_UnsettledFrom[col] <= row && can_fall(row, col)) {
+                    moved += fall(row, col);
+                }
+            }
+        }
+    }
+
+    // A column that didn't move is settled until something writes to it again
+    for (size_t word = 0; word < m_Unsettled.size(); ++word) {
+        for (uint64_t bits = m_Unsettled[word]; bits != 0; bits &= bits - 1) {
+            const auto col = static_cast<uint32_t>((word * BITS_PER_WORD) + std::countr_zero(bits));
+            m_UnsettledFrom[col] = m_Landed[col];
+            m_Landed[col] = m_Height;
+            if (m_UnsettledFrom[col] == m_Height) {
+                m_Unsettled[word] &= ~(1ULL << (col % BITS_PER_WORD));
+            }
+        }
+    }
+    return moved;
+}
+
+int32_t DynamicPillGameBoard::break_pieces(int32_t min_req_for_break) noexcept {
+    // clear out any previously broken entities
+    for (BoardEntity& ent : m_Cells) {
+        if (ent.EntityType == ETYPE_BROKEN) {
+            ent = EMPTY_ENTITY;
+        }
+    }
+
+    // Run lengths in two sweeps over flat arrays, with no branches on the
+    // cells. Going up and right, each cell's runs so far; then going down and
+    // left, every cell takes its whole run's length from the far end. Raw
+    // pointers throughout: writes through a uint8_t* may alias anything, so
+    // members would be reloaded every cell.
+    const uint32_t width = m_Width;
+    const BoardEntity* cells = m_Cells.data();
+    uint8_t* keys = m_RunKeys.data();
+    uint8_t* row_runs = m_RowRuns.data();
+    uint8_t* column_runs = m_ColumnRuns.data();
+
+    const size_t size = m_Cells.size();
+    for (size_t i = 0; i < size; ++i) {
+        keys[i] = run_key(cells[i]);
+    }
+
+    for (uint32_t col = 0; col < width; ++col) {
+        column_runs[col] = keys[col] != 0 ? 1 : 0;
+    }
+    for (size_t i = width; i < size; ++i) {
+        const uint8_t key = keys[i];
+        column_runs[i] = joins(key, keys[i - width]) != 0 ? saturating_next(column_runs[i - width]) : (key != 0 ? 1 : 0);
+    }
+
+    for (size_t start = 0; start < size; start += width) {
+        uint8_t run = keys[start] != 0 ? 1 : 0;
+        row_runs[start] = run;
+        for (size_t i = start + 1; i < start + width; ++i) {
+            const uint8_t key = keys[i];
+            run = joins(key, keys[i - 1]) != 0 ? saturating_next(run) : (key != 0 ? 1 : 0);
+            row_runs[i] = run;
+        }
+    }
+
+    const auto min_run = static_cast<uint8_t>(std::clamp(min_req_for_break, 1, RUN_SATURATED));
+    for (size_t i = size - width; i-- > 0;) {
+        column_runs[i] = joins(keys[i], keys[i + width]) != 0 ? column_runs[i + width] : column_runs[i];
+    }
+
+    for (size_t start = 0; start < size; start += width) {
+        for (size_t i = start + width - 1; i-- > start;) {
+            row_runs[i] = joins(keys[i], keys[i + 1]) != 0 ? row_runs[i + 1] : row_runs[i];
+        }
+    }
+
+    // row_runs becomes the cells that break
+    for (size_t i = 0; i < size; ++i) {
+        row_runs[i] = row_runs[i] >= min_run || column_runs[i] >= min_run ? 1 : 0;
+    }
+
+    int32_t pieces_broken{0};
+    for (uint32_t row = 0; row < m_Height; ++row) {
+        for (uint32_t col = 0; col < m_Width; ++col) {
+            if (m_RowRuns[(static_cast<size_t>(row) * m_Width) + col] == 0) {
+                continue;
+            }
+
+            BoardEntity& ent = at(row, col);
+            if (ent.EntityType == ETYPE_PILL) {
+                // the surviving half is a single pill now and may fall on its own
+                const auto [partner_row, partner_col] = partner_of(ent, row, col);
+                if (partner_row >= 0 && partner_row < m_Height && partner_col >= 0 && partner_col < m_Width) {
+                    const auto prow = static_cast<uint32_t>(partner_row);
+                    const auto pcol = static_cast<uint32_t>(partner_col);
+                    BoardEntity& partner = at(prow, pcol);
+                    if (partner.EntityType == ETYPE_PILL) {
+                        partner.EntityType = ETYPE_SPILL;
+                        partner.Rotation = ROTATE_NORTH;  // only whole pills are rotated; see packed_board.h
+                        unsettle(prow, pcol);
+                    }
+                }
+            }
+
+            ent.EntityType = ETYPE_BROKEN;
+            ent.Rotation = ROTATE_NORTH;
+            unsettle(row, col);
+            ++pieces_broken;
+        }
+    }
+
+    return pieces_broken;
+}
+
+}  // namespace pill_game
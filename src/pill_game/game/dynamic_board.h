@@ -0,0 +1,89 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+namespace pill_game {
+
+// clang-format off
+constexpr uint32_t DYNAMIC_BOARD_MIN_SIZE = 4;
+constexpr uint32_t DYNAMIC_BOARD_MAX_SIZE = 4096;  // per side
+// clang-format on
+
+//
+// A board sized at runtime, for endurance mode and stress tests on boards far
+// bigger than any BasicPillGameBoard. It follows the same rules, but none of
+// its passes cost more than a constant per cell:
+//
+//  - break_pieces() measures every run with two sweeps over the board, one
+//    counting run lengths forwards and one handing each run's total back,
+//    rather than rescanning both lines from every cell.
+//  - tick_gravity() only looks at columns that changed. Every write marks its
+//    column unsettled from that row up, and a column that doesn't move in a
+//    tick is settled again, so a still board costs nothing to tick.
+//
+// Full pills are expected to be set() as pairs that point at each other, as
+// on the fixed boards, and fall as they do there: a side by side pill as a
+// whole, an upright one by its bottom half with the top half lost, and
+// neither counted in what tick_gravity() returns.
+//
+class DynamicPillGameBoard {
+   private:
+    uint32_t m_Width{0};
+    uint32_t m_Height{0};
+    std::vector<BoardEntity> m_Cells{};
+
+    // Lowest row of each column that may be able to fall, m_Height if settled
+    std::vector<uint32_t> m_UnsettledFrom{};
+    std::vector<uint64_t> m_Unsettled{};  // one bit per column, for the sweep
+    std::vector<uint32_t> m_Landed{};     // lowest row landed on this tick, m_Height if none
+
+    // break_pieces() scratch, kept to avoid allocating every pass
+    std::vector<uint8_t> m_RunKeys{};     // colour + 1 of breakable cells, 0 for the rest
+    std::vector<uint8_t> m_RowRuns{};     // length of the horizontal run through each cell, then whether it breaks
+    std::vector<uint8_t> m_ColumnRuns{};  // and of the vertical one
+
+   public:
+    DynamicPillGameBoard(uint32_t width, uint32_t height);  // throws std::runtime_error
+
+   public:
+    uint32_t width() const noexcept { return m_Width; }
+    uint32_t height() const noexcept { return m_Height; }
+    std::span<const BoardEntity> cells() const noexcept { return m_Cells; }
+
+    const BoardEntity& operator()(uint32_t row, uint32_t col) const noexcept {
+        assert(row < m_Height && col < m_Width);
+        return m_Cells[(static_cast<size_t>(row) * m_Width) + col];
+    }
+
+    // Writes go through here so gravity knows which columns to look at
+    void set(uint32_t row, uint32_t col, BoardEntity entity) noexcept;
+
+    // Fills 'fill_percent' of the cells with enemies, blocks and single pills
+    // of random colours. No limit on colour runs; it's for stress, not play.
+    void fill_random(uint32_t seed, uint32_t fill_percent) noexcept;
+
+    uint32_t enemy_count() const noexcept;
+    bool is_settled() const noexcept;
+
+   public:
+    // Same steps as the fixed boards; returns the loose cells moved by one step
+    int32_t tick_gravity() noexcept;
+    int32_t break_pieces(int32_t min_req_for_break = 4) noexcept;
+
+   private:
+    BoardEntity& at(uint32_t row, uint32_t col) noexcept {
+        return m_Cells[(static_cast<size_t>(row) * m_Width) + col];
+    }
+
+    void unsettle(uint32_t row, uint32_t col) noexcept;
+    bool can_fall(uint32_t row, uint32_t col) const noexcept;
+    int32_t fall(uint32_t row, uint32_t col) noexcept;
+};
+
+}  // namespace pill_game
@@ -19,15 +19,19 @@ namespace {
 void process_events(void);
 void process_input(const SDL_Event& event);
 void tick_game(void);
+void render_text_overlay(void);
+void measure_input_latency(void) noexcept;
+void check_frame_allocations(void);
 
 }  // namespace
 
-int run_application() {
+int run_application(MatchRule rule) {
     auto ret = initialise();
     if (ret != 0) {
         PG_LOG(Err, "initialisation had non-zero {} exit code; exiting...", ret);
         return ret;
     }
+    ctx().Rule = rule;
 
     int exit_code = 0;
     ctx().Running = true;
@@ -39,14 +43,18 @@ int run_application() {
 
     while (ctx().Running) {
         uint64_t start_ticks{SDL_GetTicks()};
+        ctx().FrameArena.reset();
 
         auto* renderer = ctx().Renderer;
         ctx().DeltaTime = static_cast<float>(start_ticks - ticks_last_frame) / 1000.0F;
+        ctx().SmoothedDeltaTime = std::lerp(ctx().SmoothedDeltaTime, ctx().DeltaTime, 0.05F);
         ticks_last_frame = start_ticks;
 
+        memory::set_phase(memory::Audio);
         tick_audio();
 
         // Render background image to window
+        memory::set_phase(memory::Render);
         SDL_SetRenderTarget(renderer, nullptr);
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
         SDL_RenderClear(renderer);
@@ -61,6 +69,7 @@ int run_application() {
         SDL_SetTextureScaleMode(atlas(), SDL_SCALEMODE_LINEAR);
 
         try {
+            memory::set_phase(memory::Events);
             process_events();
             tick_game();
             ++ctx().SceneTicks;
@@ -70,21 +79,16 @@ int run_application() {
             exit_code = -1;
         }
 
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-        SDL_RenderDebugText(
-            renderer,
-            50,
-            50,
-            std::format(
-                "{:.3F}, {}, {}",
-                ctx().DeltaTime,
-                ctx().SceneTicks,
-                ctx().Running ? "Is Running" : "Is Not Running"
-            )
-                .c_str()
-        );
+        memory::set_phase(memory::Render);
+        render_text_overlay();
 
+        memory::set_phase(memory::Present);
         SDL_RenderPresent(renderer);
+        measure_input_latency();
+
+        memory::set_phase(memory::Other);
+        ctx().FrameAllocs = memory::end_frame();
+        check_frame_allocations();
 
         // primitive frame cap
         uint64_t end_ticks{SDL_GetTicks()};
@@ -121,35 +125,45 @@ void process_events(void) {
 }
 
 void process_input(const SDL_Event& event) {
-    const uint8_t val = (event.type == SDL_EVENT_KEY_DOWN) ? 1 : 0;
+    const bool pressed = (event.type == SDL_EVENT_KEY_DOWN);
+    if (pressed && event.key.repeat) {
+        return;
+    }
+
+    std::optional<Button> button{};
 
     // clang-format off
     switch (event.key.key) {
-        case SDLK_UP    : ctx().Input.Up    = val; break;
-        case SDLK_DOWN  : ctx().Input.Down  = val; break;
-        case SDLK_LEFT  : ctx().Input.Left  = val; break;
-        case SDLK_S     : ctx().Input.Left  = val; break;
-        case SDLK_RIGHT : ctx().Input.Right = val; break;
-        case SDLK_D     : ctx().Input.Right = val; break;
-        case SDLK_Z     : ctx().Input.B     = val; break;
-        case SDLK_K     : ctx().Input.B     = val; break;
-        case SDLK_X     : ctx().Input.A     = val; break;
-        case SDLK_L     : ctx().Input.A     = val; break;
-        case SDLK_ESCAPE: ctx().Input.Pause = val; break;
-        case SDLK_RETURN: ctx().Input.Start = val; break;
-        case SDLK_E     : ctx().Input.Start = val; break;
+        case SDLK_UP    : button = Button::Up;    break;
+        case SDLK_DOWN  : button = Button::Down;  break;
+        case SDLK_LEFT  : button = Button::Left;  break;
+        case SDLK_S     : button = Button::Left;  break;
+        case SDLK_RIGHT : button = Button::Right; break;
+        case SDLK_D     : button = Button::Right; break;
+        case SDLK_Z     : button = Button::B;     break;
+        case SDLK_K     : button = Button::B;     break;
+        case SDLK_X     : button = Button::A;     break;
+        case SDLK_L     : button = Button::A;     break;
+        case SDLK_ESCAPE: button = Button::Pause; break;
+        case SDLK_RETURN: button = Button::Start; break;
+        case SDLK_E     : button = Button::Start; break;
     }
     // clang-format on
 
+    if (button.has_value()) {
+        set_button(ctx().Input, *button, pressed);
+
+        // stamped with when SDL saw the key, not when this frame got to it
+        ctx().Simulation->push_input(InputEvent{
+            event.key.timestamp + ctx().InputClockOffsetNs,
+            *button,
+            pressed,
+        });
+    }
+
+    // restart with a fresh board; goes through the scene so the replay stays valid
     if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_SPACE) {
-        ctx().TheBoard.init_board(
-            BoardInitParams::create_difficulty(
-                ctx().CurrentLevel,
-                ctx().AllowPills,
-                ctx().AllowBlocks
-            ),
-            rng()
-        );
+        ctx().RequestedScene = Scene::Playing;
     }
 }
 
@@ -159,14 +173,21 @@ void tick_game(void) {
         ctx().CurrentScene = ctx().RequestedScene;
         ctx().SceneTicks = 0;
         ctx().RequestedScene = Scene::None;
-        ctx().Timers.fill(Timer{});
+        ctx().SceneEvents.clear();
+        ctx().SceneClockNs = 0;
+        for (Task& task : ctx().SceneTasks) {
+            task.reset();
+        }
     }
 
-    const float delta_step = ctx().DeltaTime * (ctx().IsPaused ? 0.0F : 1.0F);
-
-    for (Timer& timer : ctx().Timers) {
-        timer.Value = std::max(timer.Value - (timer.Speed * delta_step), 0.0F);
+    // pausing freezes the scene clock, and with it everything scheduled on it
+    if (!ctx().IsPaused) {
+        ctx().SceneClockNs += static_cast<uint64_t>(ctx().DeltaTime * 1.0e9F);
     }
+    ctx().SceneEvents.advance(
+        ctx().SceneClockNs / SIM_TICK_NS,
+        [](std::coroutine_handle<> handle) { handle.resume(); }
+    );
 
     // clang-format off
     switch (ctx().CurrentScene) {
@@ -179,6 +200,85 @@ void tick_game(void) {
     // clang-format on
 }
 
+// Frame stats, then every piece of text queued this frame in a single draw
+void render_text_overlay(void) {
+    TextBuffer<128> text{};
+    const float frame_time = ctx().SmoothedDeltaTime;
+
+    text << "FPS ";
+    text.append(frame_time > 0.0F ? 1.0F / frame_time : 0.0F, 1) << " (";
+    text.append(frame_time * 1000.0F, 2) << " ms) tick " << ctx().SceneTicks;
+    draw_text(50.0F, 50.0F, text.view());
+
+    const auto& latency = ctx().Latency;
+    text.clear();
+    text << "input ";
+    text.append(latency.LastMs, 1) << " ms (avg ";
+    text.append(latency.SmoothedMs, 1) << " max ";
+    text.append(latency.MaxMs, 1) << ')';
+    draw_text(50.0F, 66.0F, text.view());
+
+    if constexpr (memory::ALLOC_TRACKING_ENABLED) {
+        const auto& phases = ctx().FrameAllocs.Phases;
+        const auto total = ctx().FrameAllocs.total();
+
+        text.clear();
+        text << "allocs " << total.Allocations << " (" << total.Bytes << " B) | events "
+             << phases.at(memory::Events).Allocations << " sim "
+             << phases.at(memory::Simulation).Allocations << " render "
+             << phases.at(memory::Render).Allocations << " present "
+             << phases.at(memory::Present).Allocations;
+        draw_text(50.0F, 82.0F, text.view());
+    }
+
+    flush_text();
+}
+
+// Runs right after the present, the earliest point the input could be on screen
+void measure_input_latency(void) noexcept {
+    auto& latency = ctx().Latency;
+    if (latency.DrawnInputNs <= latency.ShownInputNs) {
+        return;
+    }
+
+    const uint64_t elapsed_ns = sim_clock_ns() - latency.DrawnInputNs;
+    latency.ShownInputNs = latency.DrawnInputNs;
+    latency.LastMs = static_cast<float>(elapsed_ns) / 1.0e6F;
+    latency.SmoothedMs = std::lerp(latency.SmoothedMs, latency.LastMs, 0.1F);
+    latency.MaxMs = std::max(latency.MaxMs, latency.LastMs);
+}
+
+// Once a game has warmed up, a Scene::Playing frame is expected not to touch the heap
+void check_frame_allocations(void) {
+    if constexpr (!memory::ALLOC_TRACKING_ENABLED) {
+        return;
+    }
+
+    const bool steady_state = ctx().CurrentScene == Scene::Playing
+                              && ctx().RequestedScene == Scene::None
+                              && ctx().SceneTicks > memory::ALLOC_WARMUP_FRAMES;
+
+    const auto total = ctx().FrameAllocs.total();
+    if (!steady_state || total.Allocations == 0) {
+        return;
+    }
+
+    for (size_t i = 0; i < memory::PhaseCount; ++i) {
+        const auto& phase = ctx().FrameAllocs.Phases.at(i);
+        if (phase.Allocations > 0) {
+            PG_LOG(
+                Warn,
+                "steady-state frame allocated {} time(s), {} bytes during '{}'",
+                phase.Allocations,
+                phase.Bytes,
+                memory::phase_name(static_cast<memory::AllocPhase>(i))
+            );
+        }
+    }
+
+    assert(total.Allocations == 0 && "Scene::Playing allocated after warm-up");
+}
+
 }  // namespace
 
 }  // namespace pill_game::game
\ No newline at end of file
@@ -10,6 +10,13 @@
 
 #include "pill_game/game/board.h"
 #include "pill_game/game/bag_random.h"
+#include "pill_game/game/game_session.h"
+#include "pill_game/game/simulation_thread.h"
+#include "pill_game/util/alloc_tracker.h"
+#include "pill_game/util/arena.h"
+#include "pill_game/util/task.h"
+#include "pill_game/util/text_buffer.h"
+#include "pill_game/util/tick_scheduler.h"
 
 struct SDL_Window;
 struct SDL_Texture;
@@ -21,6 +28,7 @@ namespace pill_game::game {
 // clang-format off
 
 constexpr float   CELL_SIZE             = 32.0F;
+constexpr int32_t ATLAS_SIZE            = 256;
 constexpr float   MIN_WINDOW_WIDTH      = 640.0F;
 constexpr float   MIN_WINDOW_HEIGHT     = 480.0F;
 constexpr int32_t AUDIO_CHANNELS        = 1;
@@ -32,6 +40,9 @@ constexpr size_t ASSET_INDEX_PILL       = 1;
 constexpr size_t ASSET_INDEX_BACKGROUND = 2;
 constexpr size_t ASSET_COUNT            = 3;
 
+constexpr size_t SCENE_EVENT_CAPACITY   = 16;
+constexpr size_t SCENE_TASK_CAPACITY    = 8;
+
 // clang-format on
 
 struct Image {
@@ -56,19 +67,6 @@ struct Image {
     Image& operator=(const Image&&) = delete;
 };
 
-// clang-format off
-struct Controller {
-    uint8_t Up     : 1 {0};
-    uint8_t Left   : 1 {0};
-    uint8_t Right  : 1 {0};
-    uint8_t Down   : 1 {0};
-    uint8_t A      : 1 {0};
-    uint8_t B      : 1 {0};
-    uint8_t Start  : 1 {0};
-    uint8_t Pause  : 1 {0};
-};
-// clang-format on
-
 struct Colour {
     uint8_t Red{0};
     uint8_t Green{0};
@@ -87,15 +85,6 @@ enum class Scene : uint8_t {
     None
 };
 
-struct Timer {
-    float Value{0.0F};
-    float Speed{0.0F};
-    float StartingValue{0.0F};
-
-    bool expired() const noexcept { return Value <= 0.0F; }
-    void reset() noexcept { Value = StartingValue; }
-};
-
 struct FloatRect {
     float x{0.0F};
     float y{0.0F};
@@ -134,11 +123,25 @@ struct AudioSource {
     operator bool() const noexcept { return Data != nullptr; }
 };
 
+// Scene scripts waiting on the scene clock; render thread only and never
+// saved, unlike the session's events
+using SceneScheduler = TickScheduler<std::coroutine_handle<>, SCENE_EVENT_CAPACITY>;
+
+// From an input's SDL timestamp to the present of the first frame that drew it
+struct InputLatency {
+    uint64_t DrawnInputNs{0};  // newest input in the snapshot drawn this frame
+    uint64_t ShownInputNs{0};  // newest input already measured
+    float LastMs{0.0F};
+    float SmoothedMs{0.0F};
+    float MaxMs{0.0F};
+};
+
 struct GameContext {
     SDL_Renderer* Renderer{nullptr};
     SDL_Window* Window{nullptr};
     SDL_Texture* TextureAtlas{nullptr};
     SDL_Texture* GameplayTexture{nullptr};
+    SDL_Texture* GlyphAtlas{nullptr};  // null when no font could be loaded
     SDL_AudioStream* AudioStream{nullptr};  // TODO: This is the BGM stream
     uint32_t AudioDeviceId{0};
     std::array<FloatRect, ASSET_COUNT> AssetBounds{};
@@ -155,31 +158,47 @@ struct GameContext {
     uint8_t CurrentLevel{20};
     bool AllowPills{true};
     bool AllowBlocks{false};
+    MatchRule Rule{MatchRule::Lines};
 
     uint64_t SceneTicks{0};
     float DeltaTime{0.0F};
-    std::array<Timer, 16> Timers{};
-
-    PillGameBoard TheBoard;
-    BagRandom PieceRandomiser;
-    BoardPiece ThePiece;
+    float SmoothedDeltaTime{0.0F};  // for the FPS readout
+    memory::FrameAllocStats FrameAllocs{};  // heap traffic of the previous frame
+    memory::BumpArena FrameArena{memory::FRAME_ARENA_SIZE};  // reset every frame
+    SceneScheduler SceneEvents{};  // cleared on every scene change
+    std::array<Task, SCENE_TASK_CAPACITY> SceneTasks{};  // destroyed on every scene change
+    uint64_t SceneClockNs{0};  // stands still while paused
+
+    std::unique_ptr<SimulationThread> Simulation{};
+    uint32_t GameId{0};  // game the Playing scene expects snapshots for
+    uint64_t InputClockOffsetNs{0};  // SDL event timestamps -> sim_clock_ns
+    InputLatency Latency{};
 };
 
-std::mt19937& rng(void) noexcept;
 SDL_Texture* atlas(void) noexcept;
 const FloatRect& asset(size_t index);
-Timer& timer(size_t index);
+// Resumes 'handle' once, 'ticks' scene ticks (SIM_TICK_RATE) from now
+void schedule_after(uint32_t ticks, std::coroutine_handle<> handle) noexcept;
+
+// Keeps a scene script alive until it finishes or the scene changes
+void start_scene_task(Task task) noexcept;
 GameContext& ctx(void) noexcept;
 
 inline bool is_first_tick(void) noexcept {
     return ctx().SceneTicks == 0;
 }
 
-int run_application(void);
+int run_application(MatchRule rule);
 int initialise(void) noexcept;
 void init_audio(void);
+void init_text(void);
+void shutdown_text(void) noexcept;
 void shutdown(void) noexcept;
 
+// Text is queued into one batch and drawn by flush_text at the end of the frame
+void draw_text(float x, float y, std::string_view text, uint32_t colour = COLOUR_WHITE) noexcept;
+void flush_text(void) noexcept;
+
 void tick_audio(void) noexcept;
 void tick_scene_main_menu(void);
 void tick_scene_game_setup(void);
@@ -6,6 +6,8 @@
 
 #include "pill_game/pch.h"
 #include "pill_game/game/game_renderer.h"
+#include "pill_game/game/scene_script.h"
+#include "pill_game/game/sprite_batch.h"
 
 #include "SDL3/SDL.h"
 
@@ -14,23 +16,16 @@ namespace pill_game::game {
 namespace {
 
 // clang-format off
-constexpr size_t TIMER_BOARD_BUILDING = 0;
-constexpr size_t TIMER_ENEMY_TEX1     = 1;
-constexpr size_t TIMER_ENEMY_TEX2     = 2;
-constexpr size_t TIMER_PIECE_DROP     = 3;
-constexpr size_t TIMER_PIECE_HMOVE    = 4;
-constexpr size_t TIMER_PIECE_VMOVE    = 5;
-constexpr size_t TIMER_BOARD_TICKING  = 6;
-constexpr size_t TIMER_GRAVITY_TICK   = 7;
-constexpr size_t TIMER_ENT_BREAK_TICK = 8;
+constexpr uint32_t ENEMY_FRAME_TICKS_1 = 12;
+constexpr uint32_t ENEMY_FRAME_TICKS_2 = 9;
+constexpr uint32_t RESULT_HOLD_TICKS   = 2 * SIM_TICK_RATE;
 // clang-format on
 
-int32_t startup_max_index = 0;
 int32_t enemy_frame_tex1 = 0;
 int32_t enemy_frame_tex2 = 0;
-int32_t entity_updates_from_gravity = 0;
-int32_t entities_broken_last_frame = 0;
-bool place_piece_next_frame{false};
+
+SceneSignal game_over{};
+bool show_result{false};
 
 constexpr float board_height = static_cast<float>(GAME_BOARD_HEIGHT) * CELL_SIZE;
 constexpr float board_width = static_cast<float>(GAME_BOARD_WIDTH) * CELL_SIZE;
@@ -47,12 +42,14 @@ Vec2f board_pos(int32_t row, int32_t col) {
 }
 
 void first_tick_setup(void);
-void render_game_board(void);
-void render_piece_hint(void);
-void render_board_piece(const BoardPiece& piece, const Vec2f& pos);
-void draw_cell_entity(const BoardEntity& ent, const Vec2f& pos);
+Task animate_enemies(int32_t& frame, uint32_t period);
+Task hold_result(void);
+void render_game_board(SpriteBatch& batch, const GameSession& session);
+void render_piece_hint(SpriteBatch& batch, const GameSession& session);
+void render_board_piece(SpriteBatch& batch, const BoardPiece& piece, const Vec2f& pos);
+void draw_cell_entity(SpriteBatch& batch, const BoardEntity& ent, const Vec2f& pos);
 void render_game_board_texture(void);
-void handle_input(void);
+void render_hud(const GameSession& session);
 
 SDL_FRect enemy_texture_pos(bool alt_enemy, int frame) {
     const auto& bounds = asset(ASSET_INDEX_ENEMY);
@@ -71,123 +68,79 @@ void tick_scene_playing(void) {
         first_tick_setup();
     }
 
-    auto& board = ctx().TheBoard;
-    auto& the_piece = ctx().ThePiece;
-
-    // basic sprite enemy sprite animation
-    if (timer(TIMER_ENEMY_TEX1).expired()) {
-        timer(TIMER_ENEMY_TEX1).reset();
-        enemy_frame_tex1 = (enemy_frame_tex1 + 1) % 2;
-    }
-    if (timer(TIMER_ENEMY_TEX2).expired()) {
-        timer(TIMER_ENEMY_TEX2).reset();
-        enemy_frame_tex2 = (enemy_frame_tex2 + 1) % 2;
-    }
-
     int iwidth{0};
     int iheight{0};
     SDL_GetWindowSizeInPixels(ctx().Window, &iwidth, &iheight);
     ent_xoffset = static_cast<float>(iwidth) * 0.25F;
     ent_yoffset = (static_cast<float>(iheight) - (CELL_SIZE * 4.0F)) - board_height;
 
-    render_game_board();
-    render_piece_hint();
-    render_game_board_texture();
+    ctx().Simulation->set_paused(ctx().IsPaused);
 
-    // Currently 'starting up'
-    if (!timer(TIMER_BOARD_BUILDING).expired()) {
+    // until the simulation picks up the new game the previous one is still published
+    const SessionSnapshot& snapshot = ctx().Simulation->latest();
+    if (snapshot.GameId != ctx().GameId) {
         return;
     }
+    const GameSession& session = snapshot.Session;
+    ctx().Latency.DrawnInputNs = snapshot.LastInputNs;
+
+    // board, piece and hints; a quad per cell, 2 for the current piece and
+    // 2 for each of the DEFAULT_PREVIEW_DEPTH previewed pieces
+    SpriteBatch batch{
+        atlas(),
+        static_cast<float>(ATLAS_SIZE),
+        static_cast<float>(ATLAS_SIZE),
+        GAME_BOARD_SIZE + 2 + (2 * DEFAULT_PREVIEW_DEPTH),
+        &ctx().FrameArena
+    };
+    render_game_board(batch, session);
+    render_piece_hint(batch, session);
+    batch.flush(ctx().Renderer);
+    render_game_board_texture();
+    render_hud(session);
 
-    startup_max_index = static_cast<int32_t>(board.flat_game_board().size());
-
-    if (timer(TIMER_GRAVITY_TICK).expired()) {
-        timer(TIMER_GRAVITY_TICK).reset();
-        entity_updates_from_gravity = board.tick_gravity();
-    }
-
-    // don't want to break things while pieces are falling
-    if (timer(TIMER_ENT_BREAK_TICK).expired() && entity_updates_from_gravity == 0) {
-        timer(TIMER_ENT_BREAK_TICK).reset();
-        entity_updates_from_gravity = board.tick_gravity();
-        if (entity_updates_from_gravity == 0) {
-            entities_broken_last_frame = board.break_pieces();
-        }
-    }
-
-    if (entity_updates_from_gravity > 0 || entities_broken_last_frame > 0) {
-        timer(TIMER_PIECE_DROP).reset();
-        return;
-    }
-
-    if (timer(TIMER_PIECE_DROP).expired()) {
-        timer(TIMER_PIECE_DROP).reset();
-        if (board.can_piece_drop(ctx().ThePiece)) {
-            --the_piece.Row;
-        } else if (place_piece_next_frame) {
-            board.place_piece(ctx().ThePiece);
-            entities_broken_last_frame = board.break_pieces();
-            place_piece_next_frame = false;
-            ctx().ThePiece = ctx().PieceRandomiser.fetch_next(rng());
-
-        } else {
-            timer(TIMER_PIECE_DROP).Value *= 0.66F;
-            place_piece_next_frame = true;
-        }
-    }
-
-    handle_input();
-
-    if (board.is_game_over() || board.enemy_count() == 0) {
-        ctx().RequestedScene = Scene::GameFinished;
+    if (session.Finished) {
+        game_over.notify();
     }
 }
 
 namespace {
 
 void first_tick_setup(void) {
-    startup_max_index = 0;
-
-    float t = static_cast<float>(ctx().CurrentLevel) / 20.0F;
-    const float speed = 1.0F + (0.0F * t);
-
-    // clang-format off
-    timer(TIMER_BOARD_BUILDING) = Timer{ 15.0F, 1.0F , 15.0F };
-    timer(TIMER_ENEMY_TEX1)     = Timer{ 0.2F , 1.0F , 0.2F  };
-    timer(TIMER_ENEMY_TEX2)     = Timer{ 0.2F , 1.35F, 0.2F  };
-    timer(TIMER_PIECE_DROP)     = Timer{ 1.0F , speed, 1.0F  };
-    timer(TIMER_PIECE_HMOVE)    = Timer{ 1.0F , 8.0F , 1.0F  };
-    timer(TIMER_PIECE_VMOVE)    = Timer{ 1.0F , 10.0F, 1.0F  };
-    timer(TIMER_BOARD_TICKING)  = Timer{ 0.02F, 1.0F , 0.02F };
-    timer(TIMER_GRAVITY_TICK)   = Timer{ 0.25F, 1.0F , 0.25F };
-    timer(TIMER_ENT_BREAK_TICK) = Timer{ 0.66F, 1.0F , 0.66F };
-    // clang-format on
-
-    ctx().PieceRandomiser.reset(rng());
-    ctx().ThePiece = ctx().PieceRandomiser.fetch_next(rng());
-
-    // initialise the game board with the current difficulty settings
-    ctx().TheBoard.init_board(
-        BoardInitParams::create_difficulty(
-            ctx().CurrentLevel,
-            ctx().AllowPills,
-            ctx().AllowBlocks
-        ),
-        rng()
-    );
+    // basic sprite enemy sprite animation
+    start_scene_task(animate_enemies(enemy_frame_tex1, ENEMY_FRAME_TICKS_1));
+    start_scene_task(animate_enemies(enemy_frame_tex2, ENEMY_FRAME_TICKS_2));
+
+    show_result = false;
+    start_scene_task(hold_result());
+
+    ctx().Latency.MaxMs = 0.0F;
+    ctx().GameId = ctx().Simulation->start_game(GameSettings{
+        std::random_device{}(),
+        ctx().CurrentLevel,
+        ctx().AllowPills,
+        ctx().AllowBlocks,
+        ctx().Rule,
+    });
 }
 
-void render_game_board(void) {
-    if (timer(TIMER_BOARD_TICKING).expired()) {
-        timer(TIMER_BOARD_TICKING).reset();
-        const auto max_size = static_cast<int32_t>(ctx().TheBoard.flat_game_board().size());
-        startup_max_index = std::min(startup_max_index + 1, max_size);
-        if (startup_max_index == max_size) {
-            timer(TIMER_BOARD_BUILDING).Value = 0.0F;
-        }
+Task animate_enemies(int32_t& frame, uint32_t period) {
+    while (true) {
+        co_await wait_ticks(period);
+        frame = (frame + 1) % 2;
     }
+}
+
+// Leaves the final board up for a moment before moving on
+Task hold_result(void) {
+    co_await game_over;
+    show_result = true;
+    co_await wait_ticks(RESULT_HOLD_TICKS);
+    ctx().RequestedScene = Scene::GameFinished;
+}
 
-    const auto& cur_piece = ctx().ThePiece;
+void render_game_board(SpriteBatch& batch, const GameSession& session) {
+    const auto& cur_piece = session.Piece;
     auto* renderer = ctx().Renderer;
 
     SDL_SetRenderDrawColor(renderer, 30, 30, 30, 255);
@@ -199,14 +152,15 @@ void render_game_board(void) {
     };
     SDL_RenderFillRect(renderer, &board_bounds);
 
-    const PillGameBoard& board = ctx().TheBoard;
+    const PillGameBoard& board = session.Board;
 
-    for (int32_t i = 0; i < startup_max_index; ++i) {
+    for (int32_t i = 0; i < session.BuildIndex; ++i) {
         const auto& ent = board.flat_game_board().at(i);
         if (ent.is_empty()) {
             continue;
         }
         draw_cell_entity(
+            batch,
             ent,
             board_pos(
                 i / static_cast<int32_t>(GAME_BOARD_WIDTH),
@@ -215,18 +169,18 @@ void render_game_board(void) {
         );
     }
 
-    if (!timer(TIMER_BOARD_BUILDING).expired()) {
+    if (session.is_building()) {
         return;
     }
 
     // draw current piece
     const auto& [row, col] = cur_piece.right_piece_pos();
-    draw_cell_entity(cur_piece.Left, board_pos(cur_piece.Row, cur_piece.Column));
-    draw_cell_entity(cur_piece.Right, board_pos(row, col));
+    draw_cell_entity(batch, cur_piece.Left, board_pos(cur_piece.Row, cur_piece.Column));
+    draw_cell_entity(batch, cur_piece.Right, board_pos(row, col));
 }
 
-void render_piece_hint(void) {
-    auto& rand = ctx().PieceRandomiser;
+void render_piece_hint(SpriteBatch& batch, const GameSession& session) {
+    const auto& rand = session.PieceRandomiser;
     auto* renderer = ctx().Renderer;
 
     SDL_FRect hint_region{
@@ -240,23 +194,19 @@ void render_piece_hint(void) {
     SDL_RenderFillRect(renderer, &hint_region);
 
     Vec2f pos{hint_region.x, hint_region.y};
-    for (const auto& piece : rand.hints()) {
-        if (!piece.Left.is_empty()) {
-            render_board_piece(piece, pos);
-            pos.y += CELL_SIZE;
-        }
+    for (uint32_t ahead = 1; ahead <= DEFAULT_PREVIEW_DEPTH; ++ahead) {
+        render_board_piece(batch, rand.peek(ahead), pos);
+        pos.y += CELL_SIZE;
     }
 }
 
-void render_board_piece(const BoardPiece& piece, const Vec2f& pos) {
+void render_board_piece(SpriteBatch& batch, const BoardPiece& piece, const Vec2f& pos) {
     // TODO: This assumes the piece is rotated L:EAST <- R:WEST
-    const auto& [row, col] = piece.right_piece_pos();
-    draw_cell_entity(piece.Left, pos);
-    draw_cell_entity(piece.Right, Vec2f{pos.x + CELL_SIZE, pos.y});
+    draw_cell_entity(batch, piece.Left, pos);
+    draw_cell_entity(batch, piece.Right, Vec2f{pos.x + CELL_SIZE, pos.y});
 }
 
-void draw_cell_entity(const BoardEntity& ent, const Vec2f& pos) {
-    auto* renderer = ctx().Renderer;
+void draw_cell_entity(SpriteBatch& batch, const BoardEntity& ent, const Vec2f& pos) {
     SDL_FRect dst{pos.x, pos.y, CELL_SIZE, CELL_SIZE};
     SDL_FRect src{};
 
@@ -279,59 +229,31 @@ void draw_cell_entity(const BoardEntity& ent, const Vec2f& pos) {
     src.w = CELL_SIZE;
     src.h = CELL_SIZE;
 
-    Colour colour = ent.colour();
-    SDL_SetTextureColorMod(atlas(), colour.Red, colour.Green, colour.Blue);
-    if (ent.Rotation != 0) {
-        SDL_RenderTextureRotated(
-            renderer,
-            atlas(),
-            &src,
-            &dst,
-            static_cast<double>(ent.Rotation * 90.0),
-            nullptr,
-            SDL_FLIP_NONE
-        );
-    } else {
-        SDL_RenderTexture(renderer, atlas(), &src, &dst);
-    }
-    SDL_SetTextureColorMod(atlas(), 255, 255, 255);
+    // the entity colour goes in the vertices in place of a texture colour mod
+    batch.add(src, dst, ent.colour(), ent.Rotation);
 }
 
 void render_game_board_texture(void) {
 }
 
-void handle_input(void) {
-    auto& input = ctx().Input;
-    auto& board = ctx().TheBoard;
-    auto& the_piece = ctx().ThePiece;
+void render_hud(const GameSession& session) {
+    const float x = ent_xoffset + board_width + CELL_SIZE;
+    const float y = ent_yoffset + (CELL_SIZE * 3.0F);
 
-    bool can_move_horizontally = timer(TIMER_PIECE_HMOVE).expired();
-    if (can_move_horizontally && input.Left != 0) {
-        the_piece.move_left(board);
-        timer(TIMER_PIECE_HMOVE).reset();
-    }
+    TextBuffer<32> text{};
+    text << "LEVEL " << session.Level;
+    draw_text(x, y, text.view());
 
-    if (can_move_horizontally && input.Right != 0) {
-        the_piece.move_right(board);
-        timer(TIMER_PIECE_HMOVE).reset();
-    }
+    text.clear();
+    text << "SCORE " << session.Score;
+    draw_text(x, y + CELL_SIZE, text.view());
 
-    float t = static_cast<float>(ctx().CurrentLevel) / 20.0F;
-
-    if (input.Down != 0) {
-        timer(TIMER_PIECE_DROP).Speed = 12.0F;
-    } else {
-        timer(TIMER_PIECE_DROP).Speed = 1.0F + (0.0F * t);
-    }
-
-    if (input.A != 0) {
-        the_piece.rotate_piece_clockwise(board);
-        input.A = 0;
-    }
+    text.clear();
+    text << "ENEMIES " << session.Board.enemy_count();
+    draw_text(x, y + (CELL_SIZE * 2.0F), text.view());
 
-    if (input.B != 0) {
-        the_piece.rotate_piece_counter_clockwise(board);
-        input.B = 0;
+    if (show_result) {
+        draw_text(x, y + (CELL_SIZE * 3.0F), session.is_won() ? "CLEAR" : "GAME OVER");
     }
 }
 
@@ -15,7 +15,6 @@ namespace pill_game::game {
 namespace {
 
 GameContext game_context;
-std::mt19937 random_engine{0};
 
 void load_assets(void);
 
@@ -33,12 +32,26 @@ const FloatRect& asset(size_t index) {
     return game_context.AssetBounds.at(index);
 }
 
-Timer& timer(size_t index) {
-    return game_context.Timers.at(index);
+void schedule_after(uint32_t ticks, std::coroutine_handle<> handle) noexcept {
+    if (!game_context.SceneEvents.schedule_after(handle, std::max<uint32_t>(ticks, 1))) {
+        PG_LOG(Warn, "scene scheduler is full; script will not resume");
+    }
 }
 
-std::mt19937& rng(void) noexcept {
-    return random_engine;
+void start_scene_task(Task task) noexcept {
+    if (task.done()) {
+        return;
+    }
+
+    for (Task& slot : game_context.SceneTasks) {
+        if (slot.done()) {
+            slot = std::move(task);
+            return;
+        }
+    }
+    // the task may already be waiting on the scene clock
+    game_context.SceneEvents.cancel(task.handle());
+    PG_LOG(Warn, "no room for another scene task; dropping it");
 }
 
 int initialise(void) noexcept {
@@ -47,7 +60,6 @@ int initialise(void) noexcept {
     }
 
     game_context = GameContext();
-    random_engine = std::mt19937(std::random_device{}());
 
     if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO)) {
         PG_LOG(Err, "Failed to initialize SDL - {}", SDL_GetError());
@@ -99,10 +111,31 @@ int initialise(void) noexcept {
         ctx().AudioSources = {};
     }
 
+    try {
+        init_text();
+    } catch (const std::exception& ex) {
+        PG_LOG(Warn, "{}", ex.what());
+        PG_LOG(Warn, "Falling back to the debug font");
+    }
+
+    ctx().InputClockOffsetNs = sim_clock_ns() - SDL_GetTicksNS();
+    ctx().Simulation = std::make_unique<SimulationThread>();
+    ctx().Simulation->start();
+
     return 0;
 }
 
 void shutdown(void) noexcept {
+    // scene task frames belong to this thread's coroutine pool
+    ctx().SceneEvents.clear();
+    for (Task& task : ctx().SceneTasks) {
+        task.reset();
+    }
+
+    if (ctx().Simulation) {
+        ctx().Simulation->stop();
+    }
+    shutdown_text();
     SDL_DestroyTexture(ctx().TextureAtlas);
     SDL_DestroyTexture(ctx().GameplayTexture);
     SDL_DestroyRenderer(ctx().Renderer);
@@ -113,7 +146,7 @@ void shutdown(void) noexcept {
 namespace {
 
 void load_assets(void) {
-    constexpr int32_t atlas_size = 256;
+    constexpr int32_t atlas_size = ATLAS_SIZE;
     constexpr int32_t bg_width = 2;
     constexpr int32_t bg_size = bg_width * bg_width * 2;
 
@@ -0,0 +1,181 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/game/game_renderer.h"
+#include "pill_game/game/sprite_batch.h"
+
+#include "SDL3/SDL.h"
+#include "vendor/stb_truetype.h"
+
+namespace pill_game::game {
+
+namespace {
+
+// clang-format off
+constexpr int32_t GLYPH_ATLAS_SIZE  = 256;
+constexpr float   FONT_PIXEL_HEIGHT = 16.0F;
+constexpr int32_t FIRST_GLYPH       = 32;   // ' '
+constexpr int32_t GLYPH_COUNT       = 95;   // ' ' to '~'
+constexpr size_t  TEXT_QUAD_CAPACITY = 1024;
+constexpr auto    FONT_FILE         = std::string_view{"SourceCodePro-Regular.ttf"};  // SIL OFL 1.1, see assets/
+// clang-format on
+
+std::array<stbtt_packedchar, GLYPH_COUNT> glyphs{};
+float baseline_offset{0.0F};
+float line_height{FONT_PIXEL_HEIGHT};
+
+// Reused every frame; only grows if a frame has more text than it has ever had
+std::optional<SpriteBatch> text_batch{};
+
+std::vector<unsigned char> read_font_file(const fs::path& path);
+
+}  // namespace
+
+void init_text(void) {
+    const fs::path font_path = fs::current_path() / "assets" / FONT_FILE;
+    const std::vector<unsigned char> ttf = read_font_file(font_path);
+
+    stbtt_fontinfo font{};
+    if (stbtt_InitFont(&font, ttf.data(), stbtt_GetFontOffsetForIndex(ttf.data(), 0)) == 0) {
+        throw std::runtime_error{std::format("Failed to parse font - {}", font_path.string())};
+    }
+
+    int ascent{0};
+    int descent{0};
+    int line_gap{0};
+    stbtt_GetFontVMetrics(&font, &ascent, &descent, &line_gap);
+    const float scale = stbtt_ScaleForPixelHeight(&font, FONT_PIXEL_HEIGHT);
+    baseline_offset = static_cast<float>(ascent) * scale;
+    line_height = static_cast<float>(ascent - descent + line_gap) * scale;
+
+    // Rasterise the printable ASCII range once; glyph placement is done by
+    // stbtt's packer, which uses stb_rect_pack as it is included first
+    std::vector<unsigned char> alpha(static_cast<size_t>(GLYPH_ATLAS_SIZE * GLYPH_ATLAS_SIZE));
+    stbtt_pack_context packing_ctx{};
+
+    if (stbtt_PackBegin(&packing_ctx, alpha.data(), GLYPH_ATLAS_SIZE, GLYPH_ATLAS_SIZE, 0, 1, nullptr) == 0) {
+        throw std::runtime_error{"failed to begin glyph packing"};
+    }
+
+    const int packed = stbtt_PackFontRange(
+        &packing_ctx,
+        ttf.data(),
+        0,
+        FONT_PIXEL_HEIGHT,
+        FIRST_GLYPH,
+        GLYPH_COUNT,
+        glyphs.data()
+    );
+    stbtt_PackEnd(&packing_ctx);
+
+    if (packed == 0) {
+        throw std::runtime_error{"failed to pack glyphs into atlas"};
+    }
+
+    // white glyphs with coverage in alpha so they can be tinted per vertex
+    std::vector<uint32_t> pixels(alpha.size());
+    const SDL_PixelFormatDetails* fmt = SDL_GetPixelFormatDetails(SDL_PIXELFORMAT_RGBA8888);
+    for (size_t i = 0; i < alpha.size(); ++i) {
+        pixels.at(i) = SDL_MapRGBA(fmt, nullptr, 255, 255, 255, alpha.at(i));
+    }
+
+    ctx().GlyphAtlas = SDL_CreateTexture(
+        ctx().Renderer,
+        SDL_PIXELFORMAT_RGBA8888,
+        SDL_TEXTUREACCESS_STATIC,
+        GLYPH_ATLAS_SIZE,
+        GLYPH_ATLAS_SIZE
+    );
+
+    if (ctx().GlyphAtlas == nullptr) {
+        throw std::runtime_error{"failed to create glyph atlas"};
+    }
+
+    SDL_UpdateTexture(ctx().GlyphAtlas, nullptr, pixels.data(), GLYPH_ATLAS_SIZE * 4);
+    SDL_SetTextureBlendMode(ctx().GlyphAtlas, SDL_BLENDMODE_BLEND);
+
+    text_batch.emplace(
+        ctx().GlyphAtlas,
+        static_cast<float>(GLYPH_ATLAS_SIZE),
+        static_cast<float>(GLYPH_ATLAS_SIZE),
+        TEXT_QUAD_CAPACITY,
+        std::pmr::get_default_resource()
+    );
+}
+
+void shutdown_text(void) noexcept {
+    text_batch.reset();
+    SDL_DestroyTexture(ctx().GlyphAtlas);
+    ctx().GlyphAtlas = nullptr;
+}
+
+void draw_text(float x, float y, std::string_view text, uint32_t colour) noexcept {
+    // No font; fall back to SDL's built in debug font (needs null termination)
+    if (!text_batch) {
+        TextBuffer<256> fallback{};
+        fallback << text;
+        const Colour c{colour};
+        SDL_SetRenderDrawColor(ctx().Renderer, c.Red, c.Green, c.Blue, c.Alpha);
+        SDL_RenderDebugText(ctx().Renderer, x, y, fallback.c_str());
+        return;
+    }
+
+    constexpr auto atlas_size = static_cast<float>(GLYPH_ATLAS_SIZE);
+    float pen_x = x;
+    float pen_y = y + baseline_offset;
+
+    for (char c : text) {
+        if (c == '\n') {
+            pen_x = x;
+            pen_y += line_height;
+            continue;
+        }
+
+        int32_t index = static_cast<unsigned char>(c) - FIRST_GLYPH;
+        if (index < 0 || index >= GLYPH_COUNT) {
+            index = '?' - FIRST_GLYPH;
+        }
+
+        stbtt_aligned_quad quad{};
+        stbtt_GetPackedQuad(glyphs.data(), GLYPH_ATLAS_SIZE, GLYPH_ATLAS_SIZE, index, &pen_x, &pen_y, &quad, 0);
+
+        text_batch->add(
+            SDL_FRect{
+                quad.s0 * atlas_size,
+                quad.t0 * atlas_size,
+                (quad.s1 - quad.s0) * atlas_size,
+                (quad.t1 - quad.t0) * atlas_size,
+            },
+            SDL_FRect{quad.x0, quad.y0, quad.x1 - quad.x0, quad.y1 - quad.y0},
+            colour
+        );
+    }
+}
+
+void flush_text(void) noexcept {
+    if (text_batch) {
+        text_batch->flush(ctx().Renderer);
+    }
+}
+
+namespace {
+
+std::vector<unsigned char> read_font_file(const fs::path& path) {
+    std::ifstream file{path, std::ios::binary | std::ios::ate};
+    if (!file) {
+        throw std::runtime_error{std::format("Failed to open font - {}", path.string())};
+    }
+
+    std::vector<unsigned char> data(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    return data;
+}
+
+}  // namespace
+
+}  // namespace pill_game::game
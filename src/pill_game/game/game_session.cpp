@@ -0,0 +1,298 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/game/game_session.h"
+
+namespace pill_game::game {
+
+namespace {
+
+// clang-format off
+constexpr uint32_t BUILD_TIMEOUT_TICKS = 15 * SIM_TICK_RATE;
+constexpr uint32_t PIECE_DROP_TICKS    = SIM_TICK_RATE;  // one row a second, whatever the level
+constexpr uint32_t SOFT_DROP_TICKS     = 5;
+constexpr uint32_t GRAVITY_TICKS       = 15;
+constexpr uint32_t ENT_BREAK_TICKS     = 40;
+// clang-format on
+
+constexpr uint8_t event_bit(SessionEvent event) noexcept {
+    return static_cast<uint8_t>(1U << static_cast<uint8_t>(event));
+}
+
+static_assert(static_cast<size_t>(SessionEvent::Count) <= 8);
+
+}  // namespace
+
+void set_button(Controller& controller, Button button, bool pressed) noexcept {
+    const uint8_t val = pressed ? 1 : 0;
+
+    // clang-format off
+    switch (button) {
+        case Button::Up   : controller.Up    = val; break;
+        case Button::Left : controller.Left  = val; break;
+        case Button::Right: controller.Right = val; break;
+        case Button::Down : controller.Down  = val; break;
+        case Button::A    : controller.A     = val; break;
+        case Button::B    : controller.B     = val; break;
+        case Button::Start: controller.Start = val; break;
+        case Button::Pause: controller.Pause = val; break;
+    }
+    // clang-format on
+}
+
+bool is_held(const Controller& controller, Button button) noexcept {
+    // clang-format off
+    switch (button) {
+        case Button::Up   : return controller.Up    != 0;
+        case Button::Left : return controller.Left  != 0;
+        case Button::Right: return controller.Right != 0;
+        case Button::Down : return controller.Down  != 0;
+        case Button::A    : return controller.A     != 0;
+        case Button::B    : return controller.B     != 0;
+        case Button::Start: return controller.Start != 0;
+        case Button::Pause: return controller.Pause != 0;
+    }
+    // clang-format on
+    return false;
+}
+
+void TickInput::apply(const InputEvent& event) noexcept {
+    if (event.Pressed && !is_held(Held, event.Key)) {
+        Pressed |= button_bit(event.Key);
+    }
+    set_button(Held, event.Key, event.Pressed);
+}
+
+template <size_t Width, size_t Height>
+void BasicGameSession<Width, Height>::start(
+    uint32_t seed,
+    uint8_t level,
+    bool allow_pills,
+    bool allow_blocks,
+    MatchRule rule,
+    const LevelCorpus* corpus
+) noexcept {
+    Seed = seed;
+    Level = level;
+    AllowPills = allow_pills;
+    AllowBlocks = allow_blocks;
+    Rule = rule;
+
+    Ticks = 0;
+    Score = 0;
+    BuildIndex = 0;
+    GravityUpdates = 0;
+    EntitiesBroken = 0;
+    HorizontalHeldTicks = 0;
+    BufferedPresses = 0;
+    PlacePieceNextTick = false;
+    Finished = false;
+
+    SoftDrop = false;
+    DueEvents = 0;
+    Events.clear();
+    Events.schedule(SessionEvent::BuildStep, BUILD_STEP_TICKS);
+    Events.schedule(SessionEvent::BuildTimeout, BUILD_TIMEOUT_TICKS);
+    Events.schedule(SessionEvent::PieceDrop, PIECE_DROP_TICKS);
+    Events.schedule(SessionEvent::Gravity, GRAVITY_TICKS);
+    Events.schedule(SessionEvent::EntityBreak, ENT_BREAK_TICKS);
+
+    PieceRandomiser.reset(seed);
+    next_piece();
+
+    Corpus = 0;
+    if constexpr (std::is_same_v<BoardType, PillGameBoard>) {
+        if (corpus != nullptr && corpus->load(seed, Level, AllowPills, AllowBlocks, Board)) {
+            Corpus = corpus->fingerprint();
+            return;
+        }
+    } else {
+        static_cast<void>(corpus);
+    }
+
+    // initialise the game board with the current difficulty settings
+    Board.init_board(
+        BoardType::InitParams::create_difficulty(Level, AllowPills, AllowBlocks),
+        seed
+    );
+}
+
+template <size_t Width, size_t Height>
+bool BasicGameSession<Width, Height>::is_building() const noexcept {
+    return BuildIndex < static_cast<int32_t>(Board.flat_game_board().size());
+}
+
+template <size_t Width, size_t Height>
+void BasicGameSession<Width, Height>::tick(const TickInput& input) noexcept {
+    BufferedPresses |= input.Pressed;
+    ++Ticks;
+
+    if (Finished) {
+        return;
+    }
+
+    // a fired event stays due until the state it waits on lets it run
+    Events.advance(Ticks, [this](SessionEvent event) { DueEvents |= event_bit(event); });
+
+    tick_board_build();
+
+    // Currently 'starting up'
+    if (is_building()) {
+        return;
+    }
+
+    if (take_due(SessionEvent::Gravity)) {
+        rearm(SessionEvent::Gravity, GRAVITY_TICKS);
+        GravityUpdates = Board.tick_gravity();
+    }
+
+    // don't want to break things while pieces are falling
+    if (GravityUpdates == 0 && take_due(SessionEvent::EntityBreak)) {
+        rearm(SessionEvent::EntityBreak, ENT_BREAK_TICKS);
+        GravityUpdates = Board.tick_gravity();
+        if (GravityUpdates == 0) {
+            break_entities();
+        }
+    }
+
+    if (GravityUpdates > 0 || EntitiesBroken > 0) {
+        rearm(SessionEvent::PieceDrop, drop_ticks());
+        return;
+    }
+
+    if (take_due(SessionEvent::PieceDrop)) {
+        rearm(SessionEvent::PieceDrop, drop_ticks());
+        if (Board.can_piece_drop(Piece)) {
+            --Piece.Row;
+        } else if (PlacePieceNextTick) {
+            Board.place_piece(Piece);
+            break_entities();
+            PlacePieceNextTick = false;
+            next_piece();
+
+        } else {
+            // a short grace period before the piece locks
+            rearm(SessionEvent::PieceDrop, (drop_ticks() * 2U) / 3U);
+            PlacePieceNextTick = true;
+        }
+    }
+
+    tick_input(input);
+
+    if (Board.is_game_over() || Board.enemy_count() == 0) {
+        Finished = true;
+    }
+}
+
+template <size_t Width, size_t Height>
+bool BasicGameSession<Width, Height>::take_due(SessionEvent event) noexcept {
+    const bool due = (DueEvents & event_bit(event)) != 0;
+    DueEvents &= static_cast<uint8_t>(~event_bit(event));
+    return due;
+}
+
+template <size_t Width, size_t Height>
+void BasicGameSession<Width, Height>::rearm(SessionEvent event, uint32_t ticks) noexcept {
+    DueEvents &= static_cast<uint8_t>(~event_bit(event));
+    Events.schedule(event, Ticks + std::max<uint32_t>(ticks, 1));
+}
+
+template <size_t Width, size_t Height>
+uint32_t BasicGameSession<Width, Height>::drop_ticks() const noexcept {
+    return SoftDrop ? SOFT_DROP_TICKS : PIECE_DROP_TICKS;
+}
+
+template <size_t Width, size_t Height>
+void BasicGameSession<Width, Height>::next_piece() noexcept {
+    Piece = BoardType::spawned(PieceRandomiser.fetch_next());
+}
+
+template <size_t Width, size_t Height>
+void BasicGameSession<Width, Height>::tick_board_build() noexcept {
+    const auto max_size = static_cast<int32_t>(Board.flat_game_board().size());
+
+    if (take_due(SessionEvent::BuildTimeout)) {
+        BuildIndex = max_size;
+    }
+
+    if (!is_building()) {
+        return;
+    }
+
+    if (take_due(SessionEvent::BuildStep)) {
+        BuildIndex = std::min(BuildIndex + 1, max_size);
+        if (BuildIndex == max_size) {
+            Events.cancel(SessionEvent::BuildTimeout);
+        } else {
+            rearm(SessionEvent::BuildStep, BUILD_STEP_TICKS);
+        }
+    }
+}
+
+template <size_t Width, size_t Height>
+void BasicGameSession<Width, Height>::break_entities() noexcept {
+    EntitiesBroken = visit_match_rule(Rule, [this]<typename MatchPolicy>(MatchPolicy) noexcept {
+        return Board.template break_pieces<MatchPolicy>();
+    });
+    Score += static_cast<uint32_t>(EntitiesBroken) * SCORE_PER_ENTITY;
+}
+
+template <size_t Width, size_t Height>
+void BasicGameSession<Width, Height>::tick_input(const TickInput& input) noexcept {
+    const auto pressed = [this](Button button) { return (BufferedPresses & button_bit(button)) != 0; };
+    const bool left = input.Held.Left != 0;
+    const bool right = input.Held.Right != 0;
+
+    if (pressed(Button::Left)) {
+        Piece.move_left(Board);
+        HorizontalHeldTicks = 0;
+    } else if (pressed(Button::Right)) {
+        Piece.move_right(Board);
+        HorizontalHeldTicks = 0;
+    } else if (left != right) {
+        HorizontalHeldTicks = std::min<uint16_t>(HorizontalHeldTicks + 1, DAS_DELAY_TICKS);
+        if (HorizontalHeldTicks == DAS_DELAY_TICKS) {
+            if (left) {
+                Piece.move_left(Board);
+            } else {
+                Piece.move_right(Board);
+            }
+            HorizontalHeldTicks -= DAS_REPEAT_TICKS;
+        }
+    } else {
+        HorizontalHeldTicks = 0;
+    }
+
+    // a tap shorter than a tick still counts as a soft drop for that tick
+    const bool soft_drop = input.Held.Down != 0 || pressed(Button::Down);
+    if (soft_drop && !SoftDrop) {
+        // bring a slow drop forward rather than waiting out its full interval
+        const uint64_t soft_deadline = Ticks + SOFT_DROP_TICKS;
+        if (Events.deadline(SessionEvent::PieceDrop).value_or(0) > soft_deadline) {
+            Events.schedule(SessionEvent::PieceDrop, soft_deadline);
+        }
+    }
+    SoftDrop = soft_drop;
+
+    if (pressed(Button::A)) {
+        Piece.rotate_piece_clockwise(Board);
+    }
+
+    if (pressed(Button::B)) {
+        Piece.rotate_piece_counter_clockwise(Board);
+    }
+
+    BufferedPresses = 0;
+}
+
+// clang-format off
+template struct BasicGameSession<GAME_BOARD_WIDTH, GAME_BOARD_HEIGHT>;
+template struct BasicGameSession<SPRINT_BOARD_WIDTH, SPRINT_BOARD_HEIGHT>;
+template struct BasicGameSession<MARATHON_BOARD_WIDTH, MARATHON_BOARD_HEIGHT>;
+// clang-format on
+
+}  // namespace pill_game::game
@@ -0,0 +1,191 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+#include "pill_game/game/board.h"
+#include "pill_game/game/bag_random.h"
+#include "pill_game/game/level_corpus.h"
+#include "pill_game/util/tick_scheduler.h"
+
+namespace pill_game::game {
+
+// clang-format off
+
+// The simulation always advances in fixed steps, regardless of the frame rate,
+// so a game can be reproduced from its seed and per-tick inputs.
+constexpr uint32_t SIM_TICK_RATE        = 60;
+constexpr float    SIM_TICK_DELTA       = 1.0F / static_cast<float>(SIM_TICK_RATE);
+constexpr uint32_t SCORE_PER_ENTITY     = 10;
+
+// Delayed auto shift: a held direction moves once on the press, then again
+// after DAS_DELAY_TICKS and every DAS_REPEAT_TICKS from there on.
+constexpr uint16_t DAS_DELAY_TICKS      = 16;
+constexpr uint16_t DAS_REPEAT_TICKS     = 6;
+
+// A new board is revealed one cell every BUILD_STEP_TICKS before play starts
+constexpr uint32_t BUILD_STEP_TICKS     = 2;
+
+// clang-format on
+
+// clang-format off
+struct Controller {
+    uint8_t Up     : 1 {0};
+    uint8_t Left   : 1 {0};
+    uint8_t Right  : 1 {0};
+    uint8_t Down   : 1 {0};
+    uint8_t A      : 1 {0};
+    uint8_t B      : 1 {0};
+    uint8_t Start  : 1 {0};
+    uint8_t Pause  : 1 {0};
+
+    bool operator==(const Controller&) const noexcept = default;
+};
+// clang-format on
+
+static_assert(sizeof(Controller) == sizeof(uint8_t));
+
+enum class Button : uint8_t {
+    Up = 0,
+    Left,
+    Right,
+    Down,
+    A,
+    B,
+    Start,
+    Pause
+};
+
+// A button going down or up; timestamps are on the simulation clock
+struct InputEvent {
+    uint64_t TimestampNs{0};
+    Button Key{Button::Up};
+    bool Pressed{false};
+};
+
+void set_button(Controller& controller, Button button, bool pressed) noexcept;
+bool is_held(const Controller& controller, Button button) noexcept;
+
+constexpr uint8_t button_bit(Button button) noexcept {
+    return static_cast<uint8_t>(1U << static_cast<uint8_t>(button));
+}
+
+//
+// The input for one simulation tick: the buttons held at the tick's deadline
+// plus every button that went down since the previous tick, so a press and
+// release that both land between two ticks still registers.
+//
+struct TickInput {
+    Controller Held{};
+    uint8_t Pressed{0};  // one bit per Button
+
+    void apply(const InputEvent& event) noexcept;
+    bool was_pressed(Button button) const noexcept { return (Pressed & button_bit(button)) != 0; }
+    bool operator==(const TickInput&) const noexcept = default;
+
+    // Edges only belong to the tick they were applied to
+    void next_tick() noexcept { Pressed = 0; }
+};
+
+static_assert(sizeof(TickInput) == 2);
+
+// Everything in a session that happens after a delay; deadlines are in ticks
+enum class SessionEvent : uint8_t {
+    BuildStep = 0,  // reveal the next cell of the board
+    BuildTimeout,   // reveal whatever is left
+    PieceDrop,
+    Gravity,
+    EntityBreak,
+    Count
+};
+
+using SessionScheduler = TickScheduler<SessionEvent, static_cast<size_t>(SessionEvent::Count)>;
+
+//
+// All of the state required to play a single game; nothing in here touches SDL
+// so it can be ticked headlessly (replays, benchmarks) through the same code as
+// the live game.
+//
+// Templated on the board size like BasicPillGameBoard; GameSession is the
+// classic 8x16 game that replays, rollback and the renderer work with.
+//
+template <size_t Width, size_t Height>
+struct BasicGameSession {
+    using BoardType = BasicPillGameBoard<Width, Height>;
+
+    BoardType Board;
+    BagRandom PieceRandomiser;
+    BoardPiece Piece;
+    SessionScheduler Events{};
+    uint8_t DueEvents{0};  // fired but not yet acted on, one bit per SessionEvent
+
+    uint32_t Seed{0};
+    uint32_t Corpus{0};  // fingerprint of the corpus the board came from, 0 if generated
+    uint8_t Level{20};
+    bool AllowPills{true};
+    bool AllowBlocks{false};
+    MatchRule Rule{MatchRule::Lines};
+
+    uint64_t Ticks{0};
+    uint32_t Score{0};
+    int32_t BuildIndex{0};  // cells of the board revealed so far
+    int32_t GravityUpdates{0};
+    int32_t EntitiesBroken{0};
+    uint16_t HorizontalHeldTicks{0};  // DAS counter for the held direction
+    uint8_t BufferedPresses{0};  // presses not yet acted on, e.g. during gravity
+    bool SoftDrop{false};
+    bool PlacePieceNextTick{false};
+    bool Finished{false};
+
+    // Takes the board from 'corpus' when there is one, otherwise generates it.
+    // Corpora only hold classic boards; other sizes always generate. 'rule'
+    // decides what breaks for the whole game.
+    void start(
+        uint32_t seed,
+        uint8_t level,
+        bool allow_pills,
+        bool allow_blocks,
+        MatchRule rule,
+        const LevelCorpus* corpus = level_corpus()
+    ) noexcept;
+
+    // Advances the game by exactly one SIM_TICK_DELTA
+    void tick(const TickInput& input) noexcept;
+
+    bool is_building() const noexcept;
+    bool is_won() const noexcept { return Finished && Board.enemy_count() == 0; }
+
+   private:
+    bool take_due(SessionEvent event) noexcept;
+    void rearm(SessionEvent event, uint32_t ticks) noexcept;
+    uint32_t drop_ticks() const noexcept;
+    void next_piece() noexcept;
+    void tick_board_build() noexcept;
+    void break_entities() noexcept;
+    void tick_input(const TickInput& input) noexcept;
+};
+
+// clang-format off
+using GameSession         = BasicGameSession<GAME_BOARD_WIDTH, GAME_BOARD_HEIGHT>;
+using SprintGameSession   = BasicGameSession<SPRINT_BOARD_WIDTH, SPRINT_BOARD_HEIGHT>;
+using MarathonGameSession = BasicGameSession<MARATHON_BOARD_WIDTH, MARATHON_BOARD_HEIGHT>;
+
+extern template struct BasicGameSession<GAME_BOARD_WIDTH, GAME_BOARD_HEIGHT>;
+extern template struct BasicGameSession<SPRINT_BOARD_WIDTH, SPRINT_BOARD_HEIGHT>;
+extern template struct BasicGameSession<MARATHON_BOARD_WIDTH, MARATHON_BOARD_HEIGHT>;
+// clang-format on
+
+// A session is plain data so that thousands can live side by side in a pool
+// and be copied around without any fix up.
+static_assert(std::is_trivially_copyable_v<GameSession>);
+static_assert(std::is_trivially_copyable_v<SprintGameSession>);
+static_assert(std::is_trivially_copyable_v<MarathonGameSession>);
+static_assert(sizeof(GameSession) <= 512);
+static_assert(sizeof(MarathonGameSession) <= 512);
+
+}  // namespace pill_game::game
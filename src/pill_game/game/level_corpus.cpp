@@ -0,0 +1,160 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/game/level_corpus.h"
+
+namespace pill_game::game {
+
+namespace {
+
+constexpr uint32_t MAX_BOARD_ATTEMPTS = 64;
+
+std::atomic<const LevelCorpus*> active_corpus{nullptr};
+
+bool is_valid_board(const PillGameBoard& board, const BoardInitParams& params) noexcept {
+    if (board.enemy_count() == 0 || board.is_game_over()) {
+        return false;
+    }
+
+    for (uint32_t row = 0; row < GAME_BOARD_HEIGHT; ++row) {
+        for (uint32_t col = 0; col < GAME_BOARD_WIDTH; ++col) {
+            if (!board(row, col).is_empty()
+                && (board.horizontal_colour_count(row, col) > params.MaxConnectedColours
+                    || board.vertical_colour_count(row, col) > params.MaxConnectedColours)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+uint32_t fnv1a(uint32_t hash, std::span<const uint8_t> bytes) noexcept {
+    for (const uint8_t byte : bytes) {
+        hash = (hash ^ byte) * 0x01000193U;
+    }
+    return hash;
+}
+
+}  // namespace
+
+LevelCorpus::LevelCorpus(const fs::path& path)
+    : m_File(path) {
+    const std::span<const uint8_t> bytes = m_File.bytes();
+    if (bytes.size() >= sizeof(m_Header)) {
+        std::memcpy(&m_Header, bytes.data(), sizeof(m_Header));
+    }
+
+    if (bytes.size() < sizeof(m_Header) || m_Header.Magic != CORPUS_MAGIC) {
+        throw std::runtime_error{std::format("Not a level corpus - {}", path.string())};
+    }
+
+    if (m_Header.Version != CORPUS_VERSION
+        || m_Header.BoardWidth != GAME_BOARD_WIDTH
+        || m_Header.BoardHeight != GAME_BOARD_HEIGHT) {
+        throw std::runtime_error{std::format(
+            "Unsupported level corpus (version {}, {}x{} board) - {}",
+            m_Header.Version,
+            m_Header.BoardWidth,
+            m_Header.BoardHeight,
+            path.string()
+        )};
+    }
+
+    const uint64_t board_count = static_cast<uint64_t>(m_Header.BoardsPerSet) * CORPUS_SET_COUNT;
+    if (m_Header.BoardsPerSet == 0 || bytes.size() != sizeof(m_Header) + (board_count * PACKED_BOARD_SIZE)) {
+        throw std::runtime_error{std::format("Truncated level corpus - {}", path.string())};
+    }
+
+    // PackedBoard is a byte array, so any offset is suitably aligned
+    m_Boards = reinterpret_cast<const PackedBoard*>(bytes.data() + sizeof(m_Header));
+}
+
+bool LevelCorpus::load(
+    uint32_t seed,
+    uint8_t level,
+    bool allow_pills,
+    bool allow_blocks,
+    PillGameBoard& board
+) const noexcept {
+    const uint64_t set = corpus_set(level, allow_pills, allow_blocks);
+    const uint64_t index = (set * m_Header.BoardsPerSet) + (seed % m_Header.BoardsPerSet);
+    return unpack_board(m_Boards[index], board);
+}
+
+CorpusBuildStats build_level_corpus(const fs::path& path, uint32_t boards_per_set) {
+    if (boards_per_set == 0) {
+        throw std::runtime_error{"A level corpus needs at least one board per set"};
+    }
+
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    if (!file) {
+        throw std::runtime_error{std::format("Failed to create level corpus - {}", path.string())};
+    }
+
+    // the fingerprint is patched in once every board has been hashed
+    LevelCorpusHeader header{};
+    header.BoardsPerSet = boards_per_set;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    CorpusBuildStats stats{};
+    uint32_t fingerprint{0x811C9DC5U};
+    std::vector<PackedBoard> chunk{};
+    chunk.reserve(CORPUS_CHUNK_SIZE);
+
+    const auto flush_chunk = [&file, &chunk, &fingerprint]() {
+        const std::span<const uint8_t> bytes{chunk.front().data(), chunk.size() * PACKED_BOARD_SIZE};
+        fingerprint = fnv1a(fingerprint, bytes);
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        chunk.clear();
+    };
+
+    PillGameBoard board{};
+    for (uint32_t set = 0; set < CORPUS_SET_COUNT; ++set) {
+        const auto level = static_cast<uint8_t>(CORPUS_MIN_LEVEL + (set / 4));
+        const BoardInitParams params = BoardInitParams::create_difficulty(level, (set & 1U) != 0, (set & 2U) != 0);
+
+        for (uint32_t i = 0; i < boards_per_set; ++i) {
+            // a run of rejects only happens with a broken generator; keep the last try
+            for (uint32_t attempt = 0; attempt < MAX_BOARD_ATTEMPTS; ++attempt) {
+                board.init_board(params, i + (attempt * boards_per_set));
+                if (is_valid_board(board, params)) {
+                    break;
+                }
+                ++stats.Rejected;
+            }
+
+            pack_board(board, chunk.emplace_back());
+            ++stats.Boards;
+            if (chunk.size() == CORPUS_CHUNK_SIZE) {
+                flush_chunk();
+            }
+        }
+    }
+    if (!chunk.empty()) {
+        flush_chunk();
+    }
+
+    header.Fingerprint = fingerprint != 0 ? fingerprint : 1;
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.close();
+
+    if (!file) {
+        throw std::runtime_error{std::format("Failed to write level corpus - {}", path.string())};
+    }
+    return stats;
+}
+
+void set_level_corpus(const LevelCorpus* corpus) noexcept {
+    active_corpus.store(corpus, std::memory_order_release);
+}
+
+const LevelCorpus* level_corpus() noexcept {
+    return active_corpus.load(std::memory_order_acquire);
+}
+
+}  // namespace pill_game::game
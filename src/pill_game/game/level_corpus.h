@@ -0,0 +1,87 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+#include "pill_game/game/packed_board.h"
+#include "pill_game/util/mapped_file.h"
+
+namespace pill_game::game {
+
+// clang-format off
+constexpr uint32_t CORPUS_MAGIC       = 0x434C4750;  // 'PGLC'
+constexpr uint16_t CORPUS_VERSION     = 1;
+constexpr uint8_t  CORPUS_MIN_LEVEL   = 1;
+constexpr uint8_t  CORPUS_MAX_LEVEL   = 20;
+constexpr uint32_t CORPUS_SET_COUNT   = CORPUS_MAX_LEVEL * 4;  // every level with and without pills/blocks
+constexpr size_t   CORPUS_CHUNK_SIZE  = 16 * 1024;             // boards buffered per write
+constexpr auto     CORPUS_EXTENSION   = std::string_view{".pgl"};
+// clang-format on
+
+struct LevelCorpusHeader {
+    uint32_t Magic{CORPUS_MAGIC};
+    uint16_t Version{CORPUS_VERSION};
+    uint8_t BoardWidth{GAME_BOARD_WIDTH};
+    uint8_t BoardHeight{GAME_BOARD_HEIGHT};
+    uint32_t BoardsPerSet{0};
+    uint32_t Fingerprint{0};  // hash of every board; never 0, which means no corpus
+};
+
+static_assert(sizeof(LevelCorpusHeader) == 16);
+
+// Which of the CORPUS_SET_COUNT sets holds boards for these settings
+constexpr uint32_t corpus_set(uint8_t level, bool allow_pills, bool allow_blocks) noexcept {
+    const uint32_t clamped = std::clamp(level, CORPUS_MIN_LEVEL, CORPUS_MAX_LEVEL);
+    return ((clamped - CORPUS_MIN_LEVEL) * 4) + (allow_pills ? 1U : 0U) + (allow_blocks ? 2U : 0U);
+}
+
+//
+// Boards generated ahead of time for every create_difficulty() setting, read
+// through a read only mapping. A session started with a corpus takes board
+// seed % BoardsPerSet of its set instead of generating one, so setting up a
+// board is an 80 byte unpack and every build plays the same boards however
+// its floating point or library behaves.
+//
+// Set s, board i sits at header + ((s * BoardsPerSet) + i) * PACKED_BOARD_SIZE.
+//
+class LevelCorpus {
+   private:
+    MappedFile m_File;
+    LevelCorpusHeader m_Header{};
+    const PackedBoard* m_Boards{nullptr};
+
+   public:
+    explicit LevelCorpus(const fs::path& path);  // throws std::runtime_error
+
+   public:
+    // False if the board in the file doesn't unpack (the file is damaged)
+    bool load(uint32_t seed, uint8_t level, bool allow_pills, bool allow_blocks, PillGameBoard& board) const noexcept;
+
+    uint32_t boards_per_set() const noexcept { return m_Header.BoardsPerSet; }
+    uint32_t fingerprint() const noexcept { return m_Header.Fingerprint; }
+};
+
+struct CorpusBuildStats {
+    uint64_t Boards{0};
+    uint64_t Rejected{0};  // generated boards that failed validation and were replaced
+};
+
+//
+// Generates 'boards_per_set' boards for every set and writes the corpus.
+// Board i of a set is the generated board for seed i where that passes
+// validation (colour runs within MaxConnectedColours, at least one enemy, the
+// entry cells clear), otherwise the next seed i + k * boards_per_set that does.
+//
+CorpusBuildStats build_level_corpus(const fs::path& path, uint32_t boards_per_set);
+
+// The corpus sessions take their boards from, or null to generate them. The
+// caller keeps it alive for as long as sessions may start.
+void set_level_corpus(const LevelCorpus* corpus) noexcept;
+const LevelCorpus* level_corpus() noexcept;
+
+}  // namespace pill_game::game
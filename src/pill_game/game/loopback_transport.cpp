@@ -0,0 +1,45 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/game/loopback_transport.h"
+
+namespace pill_game::game {
+
+LoopbackTransport::LoopbackTransport(const LoopbackSettings& settings) noexcept
+    : m_Settings(settings),
+      m_Rng(settings.Seed) {
+}
+
+void LoopbackTransport::send(PlayerId to, const InputPacket& packet, uint64_t now) noexcept {
+    ++m_Sent;
+
+    Channel& channel = m_Channels.at(to);
+    const bool lost = (m_Rng() % 100) < m_Settings.LossPercent;
+    if (lost || channel.Size == channel.Queue.size()) {
+        ++m_Dropped;
+        return;
+    }
+
+    // a fixed latency keeps delivery in order, like most real links
+    const size_t tail = (channel.Head + channel.Size) % channel.Queue.size();
+    channel.Queue.at(tail) = InFlight{now + m_Settings.LatencyTicks, packet};
+    ++channel.Size;
+}
+
+std::optional<InputPacket> LoopbackTransport::receive(PlayerId to, uint64_t now) noexcept {
+    Channel& channel = m_Channels.at(to);
+    if (channel.Size == 0 || channel.Queue.at(channel.Head).DeliverAt > now) {
+        return std::nullopt;
+    }
+
+    const InputPacket packet = channel.Queue.at(channel.Head).Packet;
+    channel.Head = (channel.Head + 1) % channel.Queue.size();
+    --channel.Size;
+    return packet;
+}
+
+}  // namespace pill_game::game
@@ -0,0 +1,62 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+#include "pill_game/game/rollback.h"
+
+namespace pill_game::game {
+
+// clang-format off
+constexpr size_t LOOPBACK_QUEUE_CAPACITY = 256;  // packets in flight per direction
+// clang-format on
+
+struct LoopbackSettings {
+    uint32_t LatencyTicks{4};   // one way
+    uint32_t LossPercent{0};
+    uint32_t Seed{1};
+};
+
+//
+// Stand-in for a network between two peers in the same process: every packet
+// is delivered LatencyTicks after it was sent, unless it is dropped. The
+// clock is whatever tick the caller passes in, so runs are reproducible.
+//
+class LoopbackTransport {
+   private:
+    struct InFlight {
+        uint64_t DeliverAt{0};
+        InputPacket Packet{};
+    };
+
+    struct Channel {
+        std::array<InFlight, LOOPBACK_QUEUE_CAPACITY> Queue{};
+        size_t Head{0};
+        size_t Size{0};
+    };
+
+    LoopbackSettings m_Settings{};
+    std::array<Channel, MATCH_PLAYERS> m_Channels{};  // indexed by receiver
+    GameRng m_Rng{};
+    uint64_t m_Sent{0};
+    uint64_t m_Dropped{0};
+
+   public:
+    explicit LoopbackTransport(const LoopbackSettings& settings) noexcept;
+
+   public:
+    void send(PlayerId to, const InputPacket& packet, uint64_t now) noexcept;
+
+    // Next packet for 'to' that has arrived by 'now'
+    std::optional<InputPacket> receive(PlayerId to, uint64_t now) noexcept;
+
+    uint64_t sent() const noexcept { return m_Sent; }
+    uint64_t dropped() const noexcept { return m_Dropped; }
+};
+
+}  // namespace pill_game::game
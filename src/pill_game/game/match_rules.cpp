@@ -0,0 +1,39 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/game/match_rules.h"
+
+namespace pill_game {
+
+namespace {
+
+// clang-format off
+constexpr std::array<std::string_view, static_cast<size_t>(MatchRule::Count)> MATCH_RULE_NAMES{
+    "lines",
+    "clusters",
+    "shapes",
+};
+// clang-format on
+
+}  // namespace
+
+std::string_view match_rule_name(MatchRule rule) noexcept {
+    const auto index = static_cast<size_t>(rule);
+    return index < MATCH_RULE_NAMES.size() ? MATCH_RULE_NAMES.at(index) : "unknown";
+}
+
+bool parse_match_rule(std::string_view name, MatchRule& rule) noexcept {
+    for (size_t i = 0; i < MATCH_RULE_NAMES.size(); ++i) {
+        if (MATCH_RULE_NAMES.at(i) == name) {
+            rule = static_cast<MatchRule>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace pill_game
@@ -0,0 +1,61 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+namespace pill_game {
+
+enum class MatchRule : uint8_t {
+    Lines = 0,  // straight horizontal or vertical lines, the classic game
+    Clusters,   // any group of touching cells of one colour
+    Shapes,     // lines, plus L, T and + shapes of shorter arms
+    Count
+};
+
+//
+// Policies for BasicPillGameBoard::break_pieces(). Each names the rule it
+// implements and gets its own kernel in board.cpp, so a board only pays for
+// the rule it was built with; the rule is picked once per break, outside of
+// any loop over the board (see visit_match_rule()).
+//
+// For every rule a cell only breaks with others of its colour and only if it
+// is breakable; 'min_req_for_break' is the cells a line or cluster needs.
+//
+
+struct LineMatch {
+    static constexpr MatchRule RULE = MatchRule::Lines;
+};
+
+struct ClusterMatch {
+    static constexpr MatchRule RULE = MatchRule::Clusters;
+};
+
+struct ShapeMatch {
+    static constexpr MatchRule RULE = MatchRule::Shapes;
+
+    // A horizontal and vertical line crossing at a cell break together when
+    // both are at least this long, even if neither is a full line
+    static constexpr int32_t MIN_ARM = 3;
+};
+
+// Calls 'fn' with the policy for 'rule'
+template <typename Fn>
+decltype(auto) visit_match_rule(MatchRule rule, Fn&& fn) {
+    switch (rule) {
+        case MatchRule::Clusters: return fn(ClusterMatch{});
+        case MatchRule::Shapes: return fn(ShapeMatch{});
+        default: return fn(LineMatch{});
+    }
+}
+
+std::string_view match_rule_name(MatchRule rule) noexcept;
+
+// False, leaving 'rule' as it was, if 'name' isn't one of match_rule_name()
+bool parse_match_rule(std::string_view name, MatchRule& rule) noexcept;
+
+}  // namespace pill_game
@@ -0,0 +1,382 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/game/packed_board.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>
+#define PG_PACK_SSE2 1
+#endif
+
+namespace pill_game {
+
+namespace {
+
+// clang-format off
+constexpr uint8_t CODE_ENEMY  = 1;
+constexpr uint8_t CODE_BLOCK  = 4;
+constexpr uint8_t CODE_PILL   = 7;
+constexpr uint8_t CODE_SPILL  = 19;
+constexpr uint8_t CODE_BROKEN = 22;
+constexpr size_t  GROUP_CELLS = 8;  // eight 5 bit codes fill five bytes
+constexpr size_t  GROUP_BYTES = (GROUP_CELLS * PACKED_CELL_BITS) / 8;
+constexpr uint64_t CODE_MASK  = (1U << PACKED_CELL_BITS) - 1;
+constexpr size_t  LAST_GROUP    = PACKED_BOARD_SIZE - GROUP_BYTES;  // the one group a uint64_t overruns
+// clang-format on
+
+// the SIMD paths work on the raw byte, so pin down how the bit-field is laid out
+static_assert(std::bit_cast<uint8_t>(BoardEntity{1, 2, 3}) == (1U | (2U << 3U) | (3U << 6U)));
+
+constexpr uint8_t code_of(uint8_t byte) noexcept {
+    const uint8_t colour = byte & 7U;
+    const uint8_t type = (byte >> 3U) & 7U;
+    const uint8_t rotation = byte >> 6U;
+
+    if (type == ETYPE_NONE || colour >= PACKED_COLOURS) {
+        return 0;
+    }
+
+    // clang-format off
+    switch (type) {
+        case ETYPE_ENEMY:  return CODE_ENEMY + colour;
+        case ETYPE_BLOCK:  return CODE_BLOCK + colour;
+        case ETYPE_PILL:   return CODE_PILL + (colour * 4) + rotation;
+        case ETYPE_SPILL:  return CODE_SPILL + colour;
+        case ETYPE_BROKEN: return CODE_BROKEN + colour;
+        default:           return 0;
+    }
+    // clang-format on
+}
+
+constexpr uint8_t byte_of(uint8_t code) noexcept {
+    const auto entity = [](uint8_t colour, uint8_t type, uint8_t rotation) {
+        return static_cast<uint8_t>(colour | (type << 3U) | (rotation << 6U));
+    };
+
+    if (code >= CODE_BROKEN && code < PACKED_CELL_COUNT) {
+        return entity(code - CODE_BROKEN, ETYPE_BROKEN, 0);
+    }
+    if (code >= CODE_SPILL && code < CODE_BROKEN) {
+        return entity(code - CODE_SPILL, ETYPE_SPILL, 0);
+    }
+    if (code >= CODE_PILL && code < CODE_SPILL) {
+        return entity((code - CODE_PILL) / 4, ETYPE_PILL, (code - CODE_PILL) % 4);
+    }
+    if (code >= CODE_BLOCK && code < CODE_PILL) {
+        return entity(code - CODE_BLOCK, ETYPE_BLOCK, 0);
+    }
+    if (code >= CODE_ENEMY && code < CODE_BLOCK) {
+        return entity(code - CODE_ENEMY, ETYPE_ENEMY, 0);
+    }
+    return 0;
+}
+
+template <size_t N, class Fn>
+constexpr std::array<uint8_t, N> make_table(Fn fn) noexcept {
+    std::array<uint8_t, N> table{};
+    for (size_t i = 0; i < N; ++i) {
+        table.at(i) = fn(static_cast<uint8_t>(i));
+    }
+    return table;
+}
+
+constexpr auto CODE_OF_BYTE = make_table<256>(code_of);
+constexpr auto BYTE_OF_CODE = make_table<1U << PACKED_CELL_BITS>(byte_of);
+
+// every code maps back to a byte that maps to the same code
+static_assert([] {
+    for (uint8_t code = 0; code < PACKED_CELL_COUNT; ++code) {
+        if (CODE_OF_BYTE.at(BYTE_OF_CODE.at(code)) != code) {
+            return false;
+        }
+    }
+    return true;
+}());
+
+static_assert(std::endian::native == std::endian::little, "groups are stored as the low bytes of a uint64_t");
+
+void store_group(uint8_t* out, uint64_t group) noexcept {
+    std::memcpy(out, &group, GROUP_BYTES);
+}
+
+uint64_t load_group(const uint8_t* in) noexcept {
+    uint64_t group{0};
+    std::memcpy(&group, in, GROUP_BYTES);
+    return group;
+}
+
+[[maybe_unused]] void pack_scalar(const uint8_t* cells, uint8_t* out) noexcept {
+    for (size_t i = 0; i < GAME_BOARD_SIZE; i += GROUP_CELLS) {
+        uint64_t group{0};
+        for (size_t c = 0; c < GROUP_CELLS; ++c) {
+            group |= static_cast<uint64_t>(CODE_OF_BYTE[cells[i + c]]) << (c * PACKED_CELL_BITS);
+        }
+        store_group(out + ((i / GROUP_CELLS) * GROUP_BYTES), group);
+    }
+}
+
+[[maybe_unused]] bool unpack_scalar(const uint8_t* in, uint8_t* cells) noexcept {
+    uint8_t invalid{0};
+    for (size_t i = 0; i < GAME_BOARD_SIZE; i += GROUP_CELLS) {
+        const uint64_t group = load_group(in + ((i / GROUP_CELLS) * GROUP_BYTES));
+        for (size_t c = 0; c < GROUP_CELLS; ++c) {
+            const auto code = static_cast<uint8_t>((group >> (c * PACKED_CELL_BITS)) & CODE_MASK);
+            invalid |= static_cast<uint8_t>(code >= PACKED_CELL_COUNT);
+            cells[i + c] = BYTE_OF_CODE[code];
+        }
+    }
+    return invalid == 0;
+}
+
+#if PG_PACK_SSE2
+
+//
+// Sixteen cells at a time. The code is worked out arithmetically from the
+// entity type (a compare per type) rather than through a table, then pairs,
+// quads and octets of codes are folded together with shifts until each
+// 64 bit lane holds eight codes in its low 40 bits.
+//
+void pack_sse2(const uint8_t* cells, uint8_t* out) noexcept {
+    const __m128i low3 = _mm_set1_epi8(7);
+    const __m128i low2 = _mm_set1_epi8(3);
+    const __m128i colour_limit = _mm_set1_epi8(static_cast<char>(PACKED_COLOURS - 1));
+
+    static_assert(GAME_BOARD_SIZE % 16 == 0);
+    for (size_t i = 0; i < GAME_BOARD_SIZE; i += 16) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cells + i));
+        const __m128i colour = _mm_and_si128(x, low3);
+        const __m128i type = _mm_and_si128(_mm_srli_epi16(x, 3), low3);
+        const __m128i rotation = _mm_and_si128(_mm_srli_epi16(x, 6), low2);
+
+        const auto is = [&type](uint8_t etype) { return _mm_cmpeq_epi8(type, _mm_set1_epi8(static_cast<char>(etype))); };
+        const auto when = [](__m128i mask, uint8_t value) { return _mm_and_si128(mask, _mm_set1_epi8(static_cast<char>(value))); };
+        const __m128i enemy = is(ETYPE_ENEMY);
+        const __m128i block = is(ETYPE_BLOCK);
+        const __m128i pill = is(ETYPE_PILL);
+        const __m128i spill = is(ETYPE_SPILL);
+        const __m128i broken = is(ETYPE_BROKEN);
+
+        const __m128i base = _mm_or_si128(
+            _mm_or_si128(when(enemy, CODE_ENEMY), when(block, CODE_BLOCK)),
+            _mm_or_si128(when(pill, CODE_PILL), _mm_or_si128(when(spill, CODE_SPILL), when(broken, CODE_BROKEN)))
+        );
+        const __m128i coloured = _mm_or_si128(_mm_or_si128(enemy, block), _mm_or_si128(spill, broken));
+        const __m128i offset = _mm_or_si128(
+            _mm_and_si128(coloured, colour),
+            _mm_and_si128(pill, _mm_or_si128(_mm_slli_epi16(colour, 2), rotation))
+        );
+
+        // out of range colours are empty, as in the scalar path
+        const __m128i valid = _mm_cmpeq_epi8(_mm_max_epu8(colour, colour_limit), colour_limit);
+        const __m128i code = _mm_and_si128(valid, _mm_add_epi8(base, offset));
+
+        const __m128i pairs = _mm_or_si128(
+            _mm_and_si128(code, _mm_set1_epi16(0x00FF)),
+            _mm_srli_epi16(_mm_and_si128(code, _mm_set1_epi16(static_cast<short>(0xFF00))), 8 - PACKED_CELL_BITS)
+        );
+        const __m128i quads = _mm_or_si128(
+            _mm_and_si128(pairs, _mm_set1_epi32(0x0000FFFF)),
+            _mm_srli_epi32(_mm_and_si128(pairs, _mm_set1_epi32(static_cast<int>(0xFFFF0000))), 16 - (2 * PACKED_CELL_BITS))
+        );
+        const __m128i octets = _mm_or_si128(
+            _mm_and_si128(quads, _mm_set_epi32(0, -1, 0, -1)),
+            _mm_srli_epi64(_mm_and_si128(quads, _mm_set_epi32(-1, 0, -1, 0)), 32 - (4 * PACKED_CELL_BITS))
+        );
+
+        // eight byte stores; each one's top three bytes are overwritten by the next
+        uint8_t* dst = out + ((i / GROUP_CELLS) * GROUP_BYTES);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), octets);
+        if (dst + GROUP_BYTES == out + LAST_GROUP) {
+            store_group(dst + GROUP_BYTES, static_cast<uint64_t>(_mm_cvtsi128_si64(_mm_srli_si128(octets, 8))));
+        } else {
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + GROUP_BYTES), _mm_srli_si128(octets, 8));
+        }
+    }
+}
+
+//
+// Also works out the board's stats and occupancy from the codes as it goes.
+// Each kind and colour gets a compare whose mask is subtracted into per byte
+// counters (at most eight per byte), summed once at the end; the movemask of
+// the solid cells in each sixteen is two whole occupancy rows.
+//
+bool unpack_sse2(const uint8_t* in, uint8_t* cells, PillGameBoard::Stats& stats, PillGameBoard::Occupancy& occupancy) noexcept {
+    static_assert(GAME_BOARD_WIDTH * 2 == 16, "each sixteen cells are two rows");
+
+    const auto bytes = [](uint8_t value) { return _mm_set1_epi8(static_cast<char>(value)); };
+    const auto total = [](__m128i per_byte) {
+        const __m128i sums = _mm_sad_epu8(per_byte, _mm_setzero_si128());
+        return static_cast<PillGameBoard::Stats::Count>(_mm_cvtsi128_si32(sums) + _mm_extract_epi16(sums, 4));
+    };
+    struct Counters {
+        __m128i Enemies;
+        __m128i Pills;
+        __m128i Blocks;
+    };
+    __m128i invalid = _mm_setzero_si128();
+    std::array<Counters, PACKED_COLOURS> counters{};
+
+    for (size_t i = 0; i < GAME_BOARD_SIZE; i += 16) {
+        // eight byte loads; the masks below drop the next group's bytes
+        const uint8_t* src = in + ((i / GROUP_CELLS) * GROUP_BYTES);
+        const __m128i second = src + GROUP_BYTES == in + LAST_GROUP
+                                   ? _mm_cvtsi64_si128(static_cast<int64_t>(load_group(src + GROUP_BYTES)))
+                                   : _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + GROUP_BYTES));
+        const __m128i octets = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)), second);
+
+        const __m128i quads = _mm_or_si128(
+            _mm_and_si128(octets, _mm_set_epi32(0, 0xFFFFF, 0, 0xFFFFF)),
+            _mm_slli_epi64(_mm_and_si128(_mm_srli_epi64(octets, 4 * PACKED_CELL_BITS), _mm_set_epi32(0, 0xFFFFF, 0, 0xFFFFF)), 32)
+        );
+        const __m128i pairs = _mm_or_si128(
+            _mm_and_si128(quads, _mm_set1_epi32(0x3FF)),
+            _mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(quads, 2 * PACKED_CELL_BITS), _mm_set1_epi32(0x3FF)), 16)
+        );
+        const __m128i code = _mm_or_si128(
+            _mm_and_si128(pairs, _mm_set1_epi16(0x1F)),
+            _mm_slli_epi16(_mm_and_si128(_mm_srli_epi16(pairs, PACKED_CELL_BITS), _mm_set1_epi16(0x1F)), 8)
+        );
+        invalid = _mm_or_si128(invalid, _mm_cmpgt_epi8(code, bytes(PACKED_CELL_COUNT - 1)));
+
+        // which range each code falls in gives both the type and the first code of that type
+        const __m128i from_enemy = _mm_cmpgt_epi8(code, bytes(CODE_ENEMY - 1));
+        const __m128i from_block = _mm_cmpgt_epi8(code, bytes(CODE_BLOCK - 1));
+        const __m128i from_pill = _mm_cmpgt_epi8(code, bytes(CODE_PILL - 1));
+        const __m128i from_spill = _mm_cmpgt_epi8(code, bytes(CODE_SPILL - 1));
+        const __m128i from_broken = _mm_cmpgt_epi8(code, bytes(CODE_BROKEN - 1));
+        const auto step = [](__m128i mask, uint8_t value) { return _mm_and_si128(mask, _mm_set1_epi8(static_cast<char>(value))); };
+
+        const __m128i first = _mm_add_epi8(
+            _mm_add_epi8(step(from_enemy, CODE_ENEMY), step(from_block, CODE_BLOCK - CODE_ENEMY)),
+            _mm_add_epi8(
+                step(from_pill, CODE_PILL - CODE_BLOCK),
+                _mm_add_epi8(step(from_spill, CODE_SPILL - CODE_PILL), step(from_broken, CODE_BROKEN - CODE_SPILL))
+            )
+        );
+        const __m128i type = _mm_add_epi8(
+            _mm_add_epi8(step(from_enemy, ETYPE_ENEMY), step(from_block, ETYPE_BLOCK - ETYPE_ENEMY)),
+            _mm_add_epi8(
+                step(from_pill, ETYPE_PILL - ETYPE_BLOCK),
+                _mm_add_epi8(step(from_spill, ETYPE_SPILL - ETYPE_PILL), step(from_broken, ETYPE_BROKEN - ETYPE_SPILL))
+            )
+        );
+
+        const __m128i offset = _mm_sub_epi8(code, first);
+        const __m128i pill = _mm_andnot_si128(from_spill, from_pill);
+        const __m128i colour = _mm_or_si128(
+            _mm_andnot_si128(pill, offset),
+            _mm_and_si128(pill, _mm_and_si128(_mm_srli_epi16(offset, 2), bytes(0x3F)))
+        );
+        const __m128i rotation = _mm_and_si128(pill, _mm_and_si128(offset, bytes(3)));
+
+        const __m128i entity = _mm_or_si128(
+            colour,
+            _mm_or_si128(_mm_slli_epi16(type, 3), _mm_slli_epi16(rotation, 6))
+        );
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(cells + i), entity);
+
+        // pills are whole or single halves; broken cells aren't counted or solid
+        const __m128i enemy = _mm_andnot_si128(from_block, from_enemy);
+        const __m128i block = _mm_andnot_si128(from_pill, from_block);
+        const __m128i any_pill = _mm_andnot_si128(from_broken, from_pill);
+        for (uint8_t c = 0; c < PACKED_COLOURS; ++c) {
+            const __m128i is_colour = _mm_cmpeq_epi8(colour, bytes(c));
+            Counters& colour_counters = counters[c];
+            colour_counters.Enemies = _mm_sub_epi8(colour_counters.Enemies, _mm_and_si128(is_colour, enemy));
+            colour_counters.Pills = _mm_sub_epi8(colour_counters.Pills, _mm_and_si128(is_colour, any_pill));
+            colour_counters.Blocks = _mm_sub_epi8(colour_counters.Blocks, _mm_and_si128(is_colour, block));
+        }
+
+        const auto solid = static_cast<uint32_t>(_mm_movemask_epi8(_mm_andnot_si128(from_broken, from_enemy)));
+        occupancy[i / GAME_BOARD_WIDTH] = static_cast<PillGameBoard::OccupancyRow>(solid & 0xFFU);
+        occupancy[(i / GAME_BOARD_WIDTH) + 1] = static_cast<PillGameBoard::OccupancyRow>(solid >> 8U);
+    }
+
+    static_assert(GAME_BOARD_SIZE / 16 <= std::numeric_limits<uint8_t>::max(), "per byte counters can't overflow");
+    for (uint8_t c = 0; c < PACKED_COLOURS; ++c) {
+        stats.Enemies[c] = total(counters[c].Enemies);
+        stats.Pills[c] = total(counters[c].Pills);
+        stats.Blocks[c] = total(counters[c].Blocks);
+    }
+    stats.EnemyTotal = static_cast<PillGameBoard::Stats::Count>(stats.Enemies[0] + stats.Enemies[1] + stats.Enemies[2]);
+
+    // a column's height is one past the highest row its bit is set in
+    uint32_t seen{0};
+    for (uint32_t row = GAME_BOARD_HEIGHT; row-- > 0;) {
+        for (uint32_t fresh = occupancy[row] & ~seen; fresh != 0; fresh &= fresh - 1) {
+            stats.ColumnHeights[std::countr_zero(fresh)] = static_cast<uint8_t>(row + 1);
+        }
+        seen |= occupancy[row];
+    }
+    stats.StackHeight = std::ranges::max(stats.ColumnHeights);
+
+    return _mm_movemask_epi8(invalid) == 0;
+}
+
+#endif
+
+}  // namespace
+
+uint8_t pack_cell(BoardEntity cell) noexcept {
+    return CODE_OF_BYTE[std::bit_cast<uint8_t>(cell)];
+}
+
+BoardEntity unpack_cell(uint8_t code) noexcept {
+    return std::bit_cast<BoardEntity>(BYTE_OF_CODE[code & CODE_MASK]);
+}
+
+BoardEntity canonical_cell(BoardEntity cell) noexcept {
+    return unpack_cell(pack_cell(cell));
+}
+
+void pack_board(const PillGameBoard& board, PackedBoard& out) noexcept {
+    const auto* cells = reinterpret_cast<const uint8_t*>(board.flat_game_board().data());
+#if PG_PACK_SSE2
+    pack_sse2(cells, out.data());
+#else
+    pack_scalar(cells, out.data());
+#endif
+}
+
+bool unpack_board(const PackedBoard& packed, PillGameBoard& board) noexcept {
+    auto* cells = reinterpret_cast<uint8_t*>(board.flat_game_board().data());
+#if PG_PACK_SSE2
+    PillGameBoard::Stats stats{};
+    PillGameBoard::Occupancy occupancy{};
+    if (unpack_sse2(packed.data(), cells, stats, occupancy)) {
+        board.set_stats(stats, occupancy);
+        return true;
+    }
+    // invalid codes leave cells the counts above don't describe
+    board.recompute_stats();
+    return false;
+#else
+    const bool valid = unpack_scalar(packed.data(), cells);
+    board.recompute_stats();
+    return valid;
+#endif
+}
+
+PackedPiece pack_piece(const BoardPiece& piece) noexcept {
+    return static_cast<PackedPiece>(pack_cell(piece.Left))
+           | (static_cast<PackedPiece>(pack_cell(piece.Right)) << 5U)
+           | (static_cast<PackedPiece>(piece.Rotation & 3U) << 10U)
+           | (static_cast<PackedPiece>(static_cast<uint8_t>(piece.Row)) << 12U)
+           | (static_cast<PackedPiece>(static_cast<uint8_t>(piece.Column)) << 20U);
+}
+
+BoardPiece unpack_piece(PackedPiece packed) noexcept {
+    return BoardPiece{
+        unpack_cell(static_cast<uint8_t>(packed & CODE_MASK)),
+        unpack_cell(static_cast<uint8_t>((packed >> 5U) & CODE_MASK)),
+        static_cast<uint8_t>((packed >> 10U) & 3U),
+        static_cast<int8_t>(static_cast<uint8_t>(packed >> 12U)),
+        static_cast<int8_t>(static_cast<uint8_t>(packed >> 20U)),
+    };
+}
+
+}  // namespace pill_game
@@ -0,0 +1,67 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+#include "pill_game/game/board.h"
+
+namespace pill_game {
+
+//
+// Canonical 5 bit cell codes. Of the 256 values a BoardEntity byte can hold
+// only 25 are ever on a board: empty, three colours each of enemy, block,
+// single pill and broken pill, and three colours times four rotations of a
+// half of a full pill. Only full pills keep a rotation (it links the halves);
+// everywhere else rotation is packed as ROTATE_NORTH.
+//
+//   0        empty
+//   1..3     enemy  colour 0..2
+//   4..6     block  colour 0..2
+//   7..18    pill   colour * 4 + rotation
+//   19..21   spill  colour 0..2
+//   22..24   broken colour 0..2
+//
+
+// clang-format off
+constexpr uint32_t PACKED_CELL_BITS   = 5;
+constexpr uint8_t  PACKED_CELL_COUNT  = 25;  // codes from here to 31 are invalid
+constexpr uint8_t  PACKED_COLOURS     = 3;
+constexpr size_t   PACKED_BOARD_SIZE  = (GAME_BOARD_SIZE * PACKED_CELL_BITS) / 8;
+// clang-format on
+
+static_assert(PACKED_CELL_COUNT <= (1U << PACKED_CELL_BITS));
+static_assert(GAME_BOARD_SIZE % 8 == 0, "cells are packed eight at a time, into five bytes");
+static_assert(PACKED_BOARD_SIZE == 80);
+
+using PackedBoard = std::array<uint8_t, PACKED_BOARD_SIZE>;
+
+// The falling piece in 32 bits: two cell codes, rotation, row and column
+using PackedPiece = uint32_t;
+
+uint8_t pack_cell(BoardEntity cell) noexcept;
+
+// Cell for a code; codes past PACKED_CELL_COUNT give EMPTY_ENTITY
+BoardEntity unpack_cell(uint8_t code) noexcept;
+
+// The entity exactly as pack_cell/unpack_cell would give it back
+BoardEntity canonical_cell(BoardEntity cell) noexcept;
+
+//
+// Whole board conversions. These use SSE2 on x86-64 and a portable scalar
+// path elsewhere; both produce the same bytes. Unpack fails (leaving 'board'
+// partly written) if any code is invalid; either way the board's stats match
+// whatever it holds. The SSE2 unpack works them out with the cells, anything
+// else recomputes them after.
+//
+void pack_board(const PillGameBoard& board, PackedBoard& out) noexcept;
+bool unpack_board(const PackedBoard& packed, PillGameBoard& board) noexcept;
+
+PackedPiece pack_piece(const BoardPiece& piece) noexcept;
+BoardPiece unpack_piece(PackedPiece packed) noexcept;
+
+}  // namespace pill_game
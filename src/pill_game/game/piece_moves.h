@@ -0,0 +1,184 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+namespace pill_game {
+
+// Everything a piece can try. A rotation that doesn't fit gets a second try
+// with the piece kicked back over the cell it turned away from.
+enum class PieceAction : uint8_t {
+    Hold = 0,  // stay put; whether the piece fits where it is
+    Left,
+    Right,
+    Drop,  // one row down; only the cells the piece doesn't already cover count
+    Clockwise,
+    ClockwiseKick,
+    CounterClockwise,
+    CounterClockwiseKick,
+    Count
+};
+
+//
+// Where an action takes a piece and the cells that must be empty for it to
+// go there: the bits from MaskColumn up in rows MaskRow and MaskRow + 1 of a
+// board's occupancy (see BasicPillGameBoard::fits()). A move that leaves the
+// board has InBounds false and no cells.
+//
+struct PieceMove {
+    int8_t Row{0};
+    int8_t Column{0};
+    uint8_t Rotation{0};
+    uint8_t MaskRow{0};
+    uint8_t MaskColumn{0};
+    uint8_t Lower{0};  // cells of MaskRow, MaskColumn first
+    uint8_t Upper{0};  // and of MaskRow + 1
+    bool InBounds{false};
+};
+
+static_assert(sizeof(PieceMove) == 8);
+
+// clang-format off
+
+// Where the right half sits from the left, and where a kick moves the piece,
+// by rotation; both as {rows, columns}
+constexpr std::array<std::array<int8_t, 2>, 4> RIGHT_HALF_OFFSET{{
+    {+1,  0},  // ROTATE_NORTH
+    { 0, +1},  // ROTATE_EAST
+    {-1,  0},  // ROTATE_SOUTH
+    { 0, -1},  // ROTATE_WEST
+}};
+
+//
+// X X X    X X X    X X X    G X X    X X X
+// R G X -> R X X -> G R X -> R X X -> R G X
+// X X X    G X X    X X X    X X X    X X X
+//
+// R G X    R X X    G R X    X G X    R G X
+// X X X -> G X X -> X X X -> X R X -> X X X
+// X X X    X X X    X X X    X X X    X X X
+//
+constexpr std::array<std::array<int8_t, 2>, 4> KICK_OFFSET{{
+    {-1,  0},  // ROTATE_NORTH
+    { 0, -1},  // ROTATE_EAST
+    {+1,  0},  // ROTATE_SOUTH
+    { 0, +1},  // ROTATE_WEST
+}};
+
+constexpr std::array<uint8_t, 4> OPPOSITE_ROTATION{ROTATE_SOUTH, ROTATE_WEST, ROTATE_NORTH, ROTATE_EAST};
+
+// clang-format on
+
+constexpr uint8_t rotated(uint8_t rotation, bool clockwise) noexcept {
+    return static_cast<uint8_t>((rotation + (clockwise ? 1U : 3U)) % 4U);
+}
+
+namespace detail {
+
+template <size_t Width, size_t Height>
+constexpr PieceMove make_piece_move(int32_t row, int32_t col, uint8_t rotation, PieceAction action) noexcept {
+    const auto kick = [&](bool clockwise) {
+        rotation = rotated(rotation, clockwise);
+        row += KICK_OFFSET[rotation][0];
+        col += KICK_OFFSET[rotation][1];
+    };
+
+    // clang-format off
+    switch (action) {
+        case PieceAction::Left                : --col; break;
+        case PieceAction::Right               : ++col; break;
+        case PieceAction::Drop                : --row; break;
+        case PieceAction::Clockwise           : rotation = rotated(rotation, true); break;
+        case PieceAction::ClockwiseKick       : kick(true); break;
+        case PieceAction::CounterClockwise    : rotation = rotated(rotation, false); break;
+        case PieceAction::CounterClockwiseKick: kick(false); break;
+        default: break;
+    }
+    // clang-format on
+
+    const int32_t right_row = row + RIGHT_HALF_OFFSET[rotation][0];
+    const int32_t right_col = col + RIGHT_HALF_OFFSET[rotation][1];
+    const auto on_board = [](int32_t r, int32_t c) {
+        return r >= 0 && std::cmp_less(r, Height) && c >= 0 && std::cmp_less(c, Width);
+    };
+    if (!on_board(row, col) || !on_board(right_row, right_col)) {
+        return PieceMove{};
+    }
+
+    // an upright piece dropping moves into its own lower cell, which is free
+    const bool needs_left = action != PieceAction::Drop || rotation != ROTATE_SOUTH;
+    const bool needs_right = action != PieceAction::Drop || rotation != ROTATE_NORTH;
+
+    // the top row has no row above it, so masks there start a row lower
+    const auto mask_row = std::min(std::min(row, right_row), static_cast<int32_t>(Height) - 2);
+    const auto mask_col = std::min(col, right_col);
+
+    PieceMove move{
+        .Row = static_cast<int8_t>(row),
+        .Column = static_cast<int8_t>(col),
+        .Rotation = rotation,
+        .MaskRow = static_cast<uint8_t>(mask_row),
+        .MaskColumn = static_cast<uint8_t>(mask_col),
+        .InBounds = true,
+    };
+    const auto need = [&](int32_t r, int32_t c) {
+        uint8_t& bits = r == mask_row ? move.Lower : move.Upper;
+        bits = static_cast<uint8_t>(bits | (1U << static_cast<uint32_t>(c - mask_col)));
+    };
+    if (needs_left) {
+        need(row, col);
+    }
+    if (needs_right) {
+        need(right_row, right_col);
+    }
+    return move;
+}
+
+}  // namespace detail
+
+//
+// Every action from every position a piece can hold on a board, built at
+// compile time; indexed by ((row * Width + column) * 4 + rotation) * actions.
+//
+template <size_t Width, size_t Height>
+inline constexpr auto PIECE_MOVES = []() {
+    constexpr auto actions = static_cast<size_t>(PieceAction::Count);
+    std::array<PieceMove, Width * Height * 4 * actions> table{};
+    for (size_t row = 0; row < Height; ++row) {
+        for (size_t col = 0; col < Width; ++col) {
+            for (uint8_t rotation = 0; rotation < 4; ++rotation) {
+                for (size_t action = 0; action < actions; ++action) {
+                    table[((((row * Width) + col) * 4 + rotation) * actions) + action] = detail::make_piece_move<Width, Height>(
+                        static_cast<int32_t>(row),
+                        static_cast<int32_t>(col),
+                        rotation,
+                        static_cast<PieceAction>(action)
+                    );
+                }
+            }
+        }
+    }
+    return table;
+}();
+
+// Pieces off the board can't do anything
+inline constexpr PieceMove NO_PIECE_MOVE{};
+
+template <size_t Width, size_t Height>
+constexpr const PieceMove& piece_move(const BoardPiece& piece, PieceAction action) noexcept {
+    if (piece.Row < 0 || std::cmp_greater_equal(piece.Row, Height)
+        || piece.Column < 0 || std::cmp_greater_equal(piece.Column, Width)) {
+        return NO_PIECE_MOVE;
+    }
+
+    const auto cell = (static_cast<size_t>(piece.Row) * Width) + static_cast<size_t>(piece.Column);
+    const auto state = (cell * 4) + (piece.Rotation & 3U);
+    return PIECE_MOVES<Width, Height>[(state * static_cast<size_t>(PieceAction::Count)) + static_cast<size_t>(action)];
+}
+
+}  // namespace pill_game
@@ -0,0 +1,122 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/game/position_file.h"
+
+namespace pill_game::game {
+
+PackedPosition pack_position(const GameSession& session) noexcept {
+    PackedPosition position{};
+    pack_board(session.Board, position.Board);
+    position.Piece = pack_piece(session.Piece);
+    position.Score = session.Score;
+    return position;
+}
+
+PositionWriter::PositionWriter(const fs::path& path)
+    : m_Path(path),
+      m_File(path, std::ios::binary | std::ios::trunc) {
+    if (!m_File) {
+        throw std::runtime_error{std::format("Failed to create position file - {}", path.string())};
+    }
+
+    // the count is patched in by finish()
+    const PositionFileHeader header{};
+    m_File.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_Chunk.reserve(POSITION_CHUNK_SIZE);
+}
+
+PositionWriter::~PositionWriter() noexcept {
+    if (!m_File.is_open()) {
+        return;
+    }
+    try {
+        finish();
+    } catch (const std::exception& ex) {
+        PG_LOG(Err, "{}", ex.what());
+    }
+}
+
+void PositionWriter::write(const GameSession& session) {
+    write(pack_position(session));
+}
+
+void PositionWriter::write(const PackedPosition& position) {
+    m_Chunk.push_back(position);
+    ++m_Count;
+    if (m_Chunk.size() == POSITION_CHUNK_SIZE) {
+        flush_chunk();
+    }
+}
+
+void PositionWriter::finish() {
+    flush_chunk();
+
+    PositionFileHeader header{};
+    header.Count = m_Count;
+    m_File.seekp(0);
+    m_File.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_File.close();
+
+    if (!m_File) {
+        throw std::runtime_error{std::format("Failed to write position file - {}", m_Path.string())};
+    }
+}
+
+void PositionWriter::flush_chunk() {
+    m_File.write(
+        reinterpret_cast<const char*>(m_Chunk.data()),
+        static_cast<std::streamsize>(m_Chunk.size() * sizeof(PackedPosition))
+    );
+    m_Chunk.clear();
+}
+
+std::vector<PackedPosition> load_positions(const fs::path& path) {
+    std::ifstream file{path, std::ios::binary};
+    if (!file) {
+        throw std::runtime_error{std::format("Failed to open position file - {}", path.string())};
+    }
+
+    PositionFileHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    if (!file || header.Magic != POSITION_MAGIC) {
+        throw std::runtime_error{std::format("Not a position file - {}", path.string())};
+    }
+
+    if (header.Version != POSITION_VERSION
+        || header.BoardWidth != GAME_BOARD_WIDTH
+        || header.BoardHeight != GAME_BOARD_HEIGHT) {
+        throw std::runtime_error{std::format(
+            "Unsupported position file (version {}, {}x{} board) - {}",
+            header.Version,
+            header.BoardWidth,
+            header.BoardHeight,
+            path.string()
+        )};
+    }
+
+    // don't trust the count with an allocation before the file backs it up
+    const uint64_t record_bytes = fs::file_size(path) - sizeof(header);
+    if (header.Count > record_bytes / sizeof(PackedPosition)) {
+        throw std::runtime_error{std::format("Truncated position file - {}", path.string())};
+    }
+
+    std::vector<PackedPosition> positions(header.Count);
+    file.read(
+        reinterpret_cast<char*>(positions.data()),
+        static_cast<std::streamsize>(positions.size() * sizeof(PackedPosition))
+    );
+
+    if (!file) {
+        throw std::runtime_error{std::format("Truncated position file - {}", path.string())};
+    }
+
+    return positions;
+}
+
+}  // namespace pill_game::game
@@ -0,0 +1,81 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+#include "pill_game/game/game_session.h"
+#include "pill_game/game/packed_board.h"
+
+namespace pill_game::game {
+
+// clang-format off
+constexpr uint32_t POSITION_MAGIC       = 0x53504750;  // 'PGPS'
+constexpr uint16_t POSITION_VERSION     = 1;
+constexpr size_t   POSITION_CHUNK_SIZE  = 16 * 1024;   // positions buffered per write
+constexpr auto     POSITION_EXTENSION   = std::string_view{".pgp"};
+// clang-format on
+
+struct PositionFileHeader {
+    uint32_t Magic{POSITION_MAGIC};
+    uint16_t Version{POSITION_VERSION};
+    uint8_t BoardWidth{GAME_BOARD_WIDTH};
+    uint8_t BoardHeight{GAME_BOARD_HEIGHT};
+    uint64_t Count{0};
+};
+
+static_assert(sizeof(PositionFileHeader) == 16);
+
+// A board, its falling piece and the score; 88 bytes against 137 unpacked
+struct PackedPosition {
+    PackedBoard Board{};
+    PackedPiece Piece{0};
+    uint32_t Score{0};
+};
+
+static_assert(sizeof(PackedPosition) == PACKED_BOARD_SIZE + 8);
+static_assert(std::is_trivially_copyable_v<PackedPosition>);
+
+PackedPosition pack_position(const GameSession& session) noexcept;
+
+//
+// Streams positions to a file: a PositionFileHeader then PackedPosition
+// records back to back. Positions are packed into a fixed chunk and written
+// POSITION_CHUNK_SIZE at a time; the count in the header is filled in by
+// finish() (or the destructor).
+//
+class PositionWriter {
+   private:
+    fs::path m_Path;
+    std::ofstream m_File;
+    std::vector<PackedPosition> m_Chunk;
+    uint64_t m_Count{0};
+
+   public:
+    explicit PositionWriter(const fs::path& path);
+    ~PositionWriter() noexcept;
+
+   public:
+    PositionWriter(const PositionWriter&) = delete;
+    PositionWriter& operator=(const PositionWriter&) = delete;
+
+   public:
+    void write(const GameSession& session);
+    void write(const PackedPosition& position);
+
+    // Flushes and patches the header; throws if the file couldn't be written
+    void finish();
+
+    uint64_t count() const noexcept { return m_Count; }
+
+   private:
+    void flush_chunk();
+};
+
+std::vector<PackedPosition> load_positions(const fs::path& path);
+
+}  // namespace pill_game::game
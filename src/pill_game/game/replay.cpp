@@ -0,0 +1,225 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/game/replay.h"
+
+namespace pill_game::game {
+
+namespace {
+
+// clang-format off
+constexpr uint8_t KEYFRAME_SOFT_DROP  = 1U << 0U;
+constexpr uint8_t KEYFRAME_PLACE_NEXT = 1U << 1U;
+constexpr uint8_t KEYFRAME_FINISHED   = 1U << 2U;
+// clang-format on
+
+}  // namespace
+
+ReplayKeyframe ReplayKeyframe::capture(const GameSession& session) noexcept {
+    ReplayKeyframe keyframe{};
+    keyframe.Tick = static_cast<uint32_t>(session.Ticks);
+    keyframe.Score = session.Score;
+    keyframe.BagIndex = session.PieceRandomiser.bag_index();
+    keyframe.BagPosition = static_cast<uint8_t>(session.PieceRandomiser.position());
+    keyframe.Piece = pack_piece(session.Piece);
+    keyframe.BuildIndex = session.BuildIndex;
+    keyframe.GravityUpdates = static_cast<int16_t>(session.GravityUpdates);
+    keyframe.EntitiesBroken = static_cast<int16_t>(session.EntitiesBroken);
+    keyframe.HorizontalHeldTicks = session.HorizontalHeldTicks;
+    keyframe.DueEvents = session.DueEvents;
+    keyframe.BufferedPresses = session.BufferedPresses;
+    keyframe.Flags = static_cast<uint8_t>(
+        (session.SoftDrop ? KEYFRAME_SOFT_DROP : 0U)
+        | (session.PlacePieceNextTick ? KEYFRAME_PLACE_NEXT : 0U)
+        | (session.Finished ? KEYFRAME_FINISHED : 0U)
+    );
+
+    for (size_t i = 0; i < keyframe.Deadlines.size(); ++i) {
+        const auto deadline = session.Events.deadline(static_cast<SessionEvent>(i));
+        keyframe.Deadlines.at(i) = static_cast<uint32_t>(deadline.value_or(0));
+    }
+
+    pack_board(session.Board, keyframe.Board);
+    return keyframe;
+}
+
+void ReplayKeyframe::restore(const ReplayHeader& header, GameSession& session) const noexcept {
+    session.Seed = header.Seed;
+    session.Corpus = header.Corpus;
+    session.Level = header.Level;
+    session.AllowPills = (header.Flags & REPLAY_FLAG_PILLS) != 0;
+    session.AllowBlocks = (header.Flags & REPLAY_FLAG_BLOCKS) != 0;
+    session.Rule = replay_rule(header);
+
+    session.Ticks = Tick;
+    session.Score = Score;
+    session.PieceRandomiser.reset(header.Seed);
+    session.PieceRandomiser.seek(BagIndex, BagPosition);
+    session.Piece = unpack_piece(Piece);
+    session.BuildIndex = BuildIndex;
+    session.GravityUpdates = GravityUpdates;
+    session.EntitiesBroken = EntitiesBroken;
+    session.HorizontalHeldTicks = HorizontalHeldTicks;
+    session.DueEvents = DueEvents;
+    session.BufferedPresses = BufferedPresses;
+    session.SoftDrop = (Flags & KEYFRAME_SOFT_DROP) != 0;
+    session.PlacePieceNextTick = (Flags & KEYFRAME_PLACE_NEXT) != 0;
+    session.Finished = (Flags & KEYFRAME_FINISHED) != 0;
+
+    // events due on the same tick only set bits in DueEvents, so the order
+    // they come back into the heap doesn't matter
+    session.Events.clear(Tick);
+    for (size_t i = 0; i < Deadlines.size(); ++i) {
+        if (Deadlines.at(i) != 0) {
+            session.Events.schedule(static_cast<SessionEvent>(i), Deadlines.at(i));
+        }
+    }
+
+    unpack_board(Board, session.Board);
+}
+
+void start_replay_session(const ReplayHeader& header, GameSession& session) noexcept {
+    const LevelCorpus* corpus = header.Corpus != 0 ? level_corpus() : nullptr;
+    if (header.Corpus != 0 && (corpus == nullptr || corpus->fingerprint() != header.Corpus)) {
+        PG_LOG(Warn, "replay with seed {} was recorded with a level corpus that isn't loaded", header.Seed);
+    }
+
+    session.start(
+        header.Seed,
+        header.Level,
+        (header.Flags & REPLAY_FLAG_PILLS) != 0,
+        (header.Flags & REPLAY_FLAG_BLOCKS) != 0,
+        replay_rule(header),
+        corpus
+    );
+}
+
+void Replay::begin(const GameSession& session) {
+    Header = ReplayHeader{};
+    Header.Level = session.Level;
+    Header.Seed = session.Seed;
+    Header.Corpus = session.Corpus;
+    Header.Flags = static_cast<uint8_t>(
+        (session.AllowPills ? REPLAY_FLAG_PILLS : 0U)
+        | (session.AllowBlocks ? REPLAY_FLAG_BLOCKS : 0U)
+        | (static_cast<uint32_t>(session.Rule) << REPLAY_RULE_SHIFT)
+    );
+
+    // an hour of play before the buffer has to grow; recording must not
+    // allocate while a game is running
+    const size_t hour_ticks = static_cast<size_t>(SIM_TICK_RATE) * 60U * 60U;
+    Inputs.clear();
+    Inputs.reserve(hour_ticks);
+    Keyframes.clear();
+    Keyframes.reserve(hour_ticks / REPLAY_KEYFRAME_TICKS);
+}
+
+void Replay::record(const GameSession& session, const TickInput& input) {
+    if (!Inputs.empty() && Inputs.size() % REPLAY_KEYFRAME_TICKS == 0) {
+        Keyframes.push_back(ReplayKeyframe::capture(session));
+    }
+    Inputs.push_back(input);
+}
+
+void Replay::finish(const GameSession& session) noexcept {
+    Header.TickCount = static_cast<uint32_t>(Inputs.size());
+    Header.FinalEnemyCount = session.Board.enemy_count();
+    Header.KeyframeCount = static_cast<uint32_t>(Keyframes.size());
+}
+
+void Replay::start_session(GameSession& session) const noexcept {
+    start_replay_session(Header, session);
+}
+
+void Replay::seek(GameSession& session, uint32_t tick) const noexcept {
+    tick = std::min(tick, static_cast<uint32_t>(Inputs.size()));
+
+    // keyframes are in tick order; find the last one at or before 'tick'
+    const auto after = std::ranges::upper_bound(Keyframes, tick, {}, &ReplayKeyframe::Tick);
+    if (after == Keyframes.begin()) {
+        start_session(session);
+    } else {
+        std::prev(after)->restore(Header, session);
+    }
+
+    for (auto t = static_cast<uint32_t>(session.Ticks); t < tick; ++t) {
+        session.tick(Inputs[t]);
+    }
+}
+
+void Replay::rebuild_keyframes() {
+    auto session = std::make_unique<GameSession>();
+    start_session(*session);
+
+    Keyframes.clear();
+    for (size_t t = REPLAY_KEYFRAME_TICKS; t < Inputs.size(); t += REPLAY_KEYFRAME_TICKS) {
+        for (size_t i = session->Ticks; i < t; ++i) {
+            session->tick(Inputs[i]);
+        }
+        Keyframes.push_back(ReplayKeyframe::capture(*session));
+    }
+    Header.KeyframeCount = static_cast<uint32_t>(Keyframes.size());
+}
+
+Replay load_replay(const fs::path& path) {
+    std::ifstream file{path, std::ios::binary};
+    if (!file) {
+        throw std::runtime_error{std::format("Failed to open replay - {}", path.string())};
+    }
+
+    Replay replay{};
+    file.read(reinterpret_cast<char*>(&replay.Header), sizeof(ReplayHeader));
+
+    if (!file || replay.Header.Magic != REPLAY_MAGIC) {
+        throw std::runtime_error{std::format("Not a replay file - {}", path.string())};
+    }
+
+    if (replay.Header.Version != REPLAY_VERSION) {
+        throw std::runtime_error{std::format(
+            "Unsupported replay version {} - {}",
+            replay.Header.Version,
+            path.string()
+        )};
+    }
+
+    replay.Inputs.resize(replay.Header.TickCount);
+    file.read(
+        reinterpret_cast<char*>(replay.Inputs.data()),
+        static_cast<std::streamsize>(replay.Inputs.size() * sizeof(TickInput))
+    );
+
+    replay.Keyframes.resize(replay.Header.KeyframeCount);
+    file.read(
+        reinterpret_cast<char*>(replay.Keyframes.data()),
+        static_cast<std::streamsize>(replay.Keyframes.size() * sizeof(ReplayKeyframe))
+    );
+
+    if (!file) {
+        throw std::runtime_error{std::format("Truncated replay - {}", path.string())};
+    }
+
+    return replay;
+}
+
+void save_replay(const Replay& replay, const fs::path& path) {
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    if (!file) {
+        throw std::runtime_error{std::format("Failed to create replay - {}", path.string())};
+    }
+
+    file.write(reinterpret_cast<const char*>(&replay.Header), sizeof(ReplayHeader));
+    file.write(
+        reinterpret_cast<const char*>(replay.Inputs.data()),
+        static_cast<std::streamsize>(replay.Inputs.size() * sizeof(TickInput))
+    );
+    file.write(
+        reinterpret_cast<const char*>(replay.Keyframes.data()),
+        static_cast<std::streamsize>(replay.Keyframes.size() * sizeof(ReplayKeyframe))
+    );
+}
+
+}  // namespace pill_game::game
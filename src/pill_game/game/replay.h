@@ -0,0 +1,108 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+#include "pill_game/game/game_session.h"
+#include "pill_game/game/packed_board.h"
+
+namespace pill_game::game {
+
+// clang-format off
+constexpr uint32_t REPLAY_MAGIC       = 0x52474750;  // 'PGGR'
+constexpr uint16_t REPLAY_VERSION        = 9;
+constexpr uint8_t  REPLAY_FLAG_PILLS     = 1U << 0U;
+constexpr uint8_t  REPLAY_FLAG_BLOCKS    = 1U << 1U;
+constexpr uint8_t  REPLAY_RULE_SHIFT     = 2;  // MatchRule in bits 2 - 3 of the flags, lines being 0
+constexpr uint8_t  REPLAY_RULE_MASK      = 3U << REPLAY_RULE_SHIFT;
+constexpr uint32_t REPLAY_KEYFRAME_TICKS = 10 * SIM_TICK_RATE;
+constexpr auto     REPLAY_EXTENSION      = std::string_view{".pgr"};
+// clang-format on
+
+struct ReplayHeader {
+    uint32_t Magic{REPLAY_MAGIC};
+    uint16_t Version{REPLAY_VERSION};
+    uint8_t Level{0};
+    uint8_t Flags{0};
+    uint32_t Seed{0};
+    uint32_t TickCount{0};
+    uint32_t FinalEnemyCount{0};  // used to detect a desync on playback
+    uint32_t KeyframeCount{0};
+    uint32_t Corpus{0};  // level corpus fingerprint, 0 when the board was generated
+};
+
+// Starts 'session' with the recorded settings, taking the board from the
+// active level corpus if the recording did
+void start_replay_session(const ReplayHeader& header, GameSession& session) noexcept;
+
+static_assert(static_cast<uint8_t>(MatchRule::Count) <= (REPLAY_RULE_MASK >> REPLAY_RULE_SHIFT) + 1);
+
+constexpr MatchRule replay_rule(const ReplayHeader& header) noexcept {
+    return static_cast<MatchRule>((header.Flags & REPLAY_RULE_MASK) >> REPLAY_RULE_SHIFT);
+}
+
+//
+// Everything a session needs to carry on from the start of 'Tick', minus what
+// the header already holds. The bag is only its position (it can seek), the
+// scheduler only its deadlines and the board is packed, so a keyframe is
+// ~130 bytes against ~420 for the session itself.
+//
+struct ReplayKeyframe {
+    uint32_t Tick{0};
+    uint32_t Score{0};
+    uint32_t BagIndex{0};
+    PackedPiece Piece{0};
+    std::array<uint32_t, static_cast<size_t>(SessionEvent::Count)> Deadlines{};  // 0 when not scheduled
+    int32_t BuildIndex{0};
+    int16_t GravityUpdates{0};
+    int16_t EntitiesBroken{0};
+    uint16_t HorizontalHeldTicks{0};
+    uint8_t BagPosition{0};
+    uint8_t DueEvents{0};
+    uint8_t BufferedPresses{0};
+    uint8_t Flags{0};
+    PackedBoard Board{};
+
+    static ReplayKeyframe capture(const GameSession& session) noexcept;
+    void restore(const ReplayHeader& header, GameSession& session) const noexcept;
+};
+
+static_assert(std::is_trivially_copyable_v<ReplayKeyframe>);
+
+//
+// A recorded game is the session seed/settings plus the input that was fed
+// into every GameSession::tick, with a keyframe every REPLAY_KEYFRAME_TICKS
+// so playback can seek without simulating from the start.
+//
+struct Replay {
+    ReplayHeader Header{};
+    std::vector<TickInput> Inputs{};
+    std::vector<ReplayKeyframe> Keyframes{};
+
+    void begin(const GameSession& session);
+
+    // 'session' is the state 'input' is about to be applied to
+    void record(const GameSession& session, const TickInput& input);
+    void finish(const GameSession& session) noexcept;
+
+    // Starts 'session' with the recorded settings
+    void start_session(GameSession& session) const noexcept;
+
+    // Leaves 'session' at the start of 'tick' (clamped to the recording),
+    // restoring the nearest keyframe and simulating the rest
+    void seek(GameSession& session, uint32_t tick) const noexcept;
+
+    // Simulates the whole recording to fill in Keyframes, e.g. after loading
+    // just the inputs from an archive
+    void rebuild_keyframes();
+};
+
+Replay load_replay(const fs::path& path);
+void save_replay(const Replay& replay, const fs::path& path);
+
+}  // namespace pill_game::game
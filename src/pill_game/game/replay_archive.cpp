@@ -0,0 +1,336 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/game/replay_archive.h"
+
+namespace pill_game::game {
+
+namespace {
+
+using InputBytes = std::array<uint8_t, sizeof(TickInput)>;
+
+constexpr size_t MAX_VARINT_SIZE = 5;
+
+// Runs of identical inputs as (varint length, input) pairs
+void pack_inputs(std::span<const TickInput> inputs, std::vector<uint8_t>& out) {
+    out.clear();
+    size_t i{0};
+    while (i < inputs.size()) {
+        size_t run{1};
+        while (i + run < inputs.size() && inputs[i + run] == inputs[i]) {
+            ++run;
+        }
+
+        auto length = static_cast<uint32_t>(run);
+        while (length >= 0x80U) {
+            out.push_back(static_cast<uint8_t>(length | 0x80U));
+            length >>= 7U;
+        }
+        out.push_back(static_cast<uint8_t>(length));
+
+        const auto bytes = std::bit_cast<InputBytes>(inputs[i]);
+        out.insert(out.end(), bytes.begin(), bytes.end());
+        i += run;
+    }
+}
+
+ArchiveRecord read_record(std::span<const uint8_t> archive, uint64_t offset) noexcept {
+    ArchiveRecord record{};
+    std::memcpy(&record, archive.data() + offset, sizeof(ArchiveRecord));
+    return record;
+}
+
+void check_archive_header(std::span<const uint8_t> archive, const fs::path& path) {
+    ArchiveHeader header{};
+    if (archive.size() >= sizeof(header)) {
+        std::memcpy(&header, archive.data(), sizeof(header));
+    }
+
+    if (archive.size() < sizeof(header) || header.Magic != ARCHIVE_MAGIC) {
+        throw std::runtime_error{std::format("Not a replay archive - {}", path.string())};
+    }
+
+    if (header.Version != ARCHIVE_VERSION) {
+        throw std::runtime_error{std::format(
+            "Unsupported replay archive version {} - {}",
+            header.Version,
+            path.string()
+        )};
+    }
+}
+
+bool entry_before(const ArchiveEntry& lhs, const ArchiveEntry& rhs) noexcept {
+    return std::tie(lhs.Level, lhs.Outcome, lhs.TickCount, lhs.Seed)
+        < std::tie(rhs.Level, rhs.Outcome, rhs.TickCount, rhs.Seed);
+}
+
+// The index if it is intact and covers exactly 'archive_size' bytes
+std::optional<ArchiveIndexHeader> check_index(std::span<const uint8_t> index, uint64_t archive_size) noexcept {
+    ArchiveIndexHeader header{};
+    if (index.size() < sizeof(header)) {
+        return std::nullopt;
+    }
+    std::memcpy(&header, index.data(), sizeof(header));
+
+    const uint64_t expected_size = sizeof(header) + (header.Count * (sizeof(ArchiveEntry) + sizeof(uint32_t)));
+    if (header.Magic != ARCHIVE_INDEX_MAGIC
+        || header.Version != ARCHIVE_VERSION
+        || header.ArchiveSize != archive_size
+        || index.size() != expected_size) {
+        return std::nullopt;
+    }
+    return header;
+}
+
+}  // namespace
+
+fs::path archive_index_path(const fs::path& archive) {
+    fs::path index{archive};
+    index.replace_extension(ARCHIVE_INDEX_EXTENSION);
+    return index;
+}
+
+void rebuild_archive_index(const fs::path& archive) {
+    const MappedFile mapped{archive};
+    const std::span<const uint8_t> bytes = mapped.bytes();
+    check_archive_header(bytes, archive);
+
+    std::vector<ArchiveEntry> entries{};
+    uint64_t offset{sizeof(ArchiveHeader)};
+    while (offset + sizeof(ArchiveRecord) <= bytes.size()) {
+        const ArchiveRecord record = read_record(bytes, offset);
+        if (record.Header.Magic != REPLAY_MAGIC
+            || offset + sizeof(ArchiveRecord) + record.PackedSize > bytes.size()) {
+            break;
+        }
+
+        entries.push_back(ArchiveEntry{
+            offset,
+            record.Header.Seed,
+            record.Header.TickCount,
+            record.PackedSize,
+            record.Header.Level,
+            outcome_of(record.Header),
+            record.Header.Flags,
+            0,
+        });
+        offset += sizeof(ArchiveRecord) + record.PackedSize;
+    }
+
+    // a write cut short leaves a partial record at the end; it stays unindexed
+    if (offset != bytes.size()) {
+        PG_LOG(Warn, "ignoring {} bytes at the end of {}", bytes.size() - offset, archive.string());
+    }
+
+    std::sort(entries.begin(), entries.end(), entry_before);
+
+    std::vector<uint32_t> by_seed(entries.size());
+    for (uint32_t i = 0; i < by_seed.size(); ++i) {
+        by_seed[i] = i;
+    }
+    std::stable_sort(by_seed.begin(), by_seed.end(), [&entries](uint32_t lhs, uint32_t rhs) {
+        return entries[lhs].Seed < entries[rhs].Seed;
+    });
+
+    ArchiveIndexHeader header{};
+    header.Count = entries.size();
+    header.ArchiveSize = bytes.size();
+
+    // readers only ever see a complete index
+    const fs::path index_path = archive_index_path(archive);
+    fs::path temp_path{index_path};
+    temp_path += ".tmp";
+    {
+        std::ofstream file{temp_path, std::ios::binary | std::ios::trunc};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(
+            reinterpret_cast<const char*>(entries.data()),
+            static_cast<std::streamsize>(entries.size() * sizeof(ArchiveEntry))
+        );
+        file.write(
+            reinterpret_cast<const char*>(by_seed.data()),
+            static_cast<std::streamsize>(by_seed.size() * sizeof(uint32_t))
+        );
+        file.close();
+
+        if (!file) {
+            throw std::runtime_error{std::format("Failed to write archive index - {}", temp_path.string())};
+        }
+    }
+    fs::rename(temp_path, index_path);
+}
+
+//
+// Writer
+//
+
+ReplayArchiveWriter::ReplayArchiveWriter(const fs::path& path)
+    : m_Path(path) {
+    std::error_code error{};
+    const bool is_new = !fs::exists(path, error) || fs::file_size(path, error) == 0;
+    if (!is_new) {
+        check_archive_header(MappedFile{path}.bytes(), path);
+    }
+
+    m_File.open(path, std::ios::binary | std::ios::app);
+    if (!m_File) {
+        throw std::runtime_error{std::format("Failed to open replay archive - {}", path.string())};
+    }
+
+    if (is_new) {
+        const ArchiveHeader header{};
+        m_File.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+}
+
+ReplayArchiveWriter::~ReplayArchiveWriter() noexcept {
+    if (!m_File.is_open()) {
+        return;
+    }
+    try {
+        finish();
+    } catch (const std::exception& ex) {
+        PG_LOG(Err, "{}", ex.what());
+    }
+}
+
+void ReplayArchiveWriter::append(const Replay& replay) {
+    pack_inputs(replay.Inputs, m_Packed);
+
+    ArchiveRecord record{};
+    record.Header = replay.Header;
+    record.Header.TickCount = static_cast<uint32_t>(replay.Inputs.size());
+    record.Header.KeyframeCount = 0;
+    record.PackedSize = static_cast<uint32_t>(m_Packed.size());
+
+    m_File.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    m_File.write(reinterpret_cast<const char*>(m_Packed.data()), static_cast<std::streamsize>(m_Packed.size()));
+    ++m_Count;
+}
+
+void ReplayArchiveWriter::finish() {
+    m_File.close();
+    if (!m_File) {
+        throw std::runtime_error{std::format("Failed to write replay archive - {}", m_Path.string())};
+    }
+    rebuild_archive_index(m_Path);
+}
+
+//
+// Reader
+//
+
+bool ReplayInputStream::next(TickInput& input) noexcept {
+    if (m_RunLeft == 0) {
+        uint32_t length{0};
+        for (uint32_t shift = 0; shift < 7 * MAX_VARINT_SIZE; shift += 7) {
+            if (m_Next == m_End) {
+                return false;
+            }
+            const uint8_t byte = *m_Next++;
+            length |= static_cast<uint32_t>(byte & 0x7FU) << shift;
+            if ((byte & 0x80U) == 0) {
+                break;
+            }
+        }
+
+        if (length == 0 || m_End - m_Next < static_cast<ptrdiff_t>(sizeof(TickInput))) {
+            m_Next = m_End;
+            return false;
+        }
+
+        InputBytes bytes{};
+        std::memcpy(bytes.data(), m_Next, bytes.size());
+        m_Input = std::bit_cast<TickInput>(bytes);
+        m_Next += bytes.size();
+        m_RunLeft = length;
+    }
+
+    --m_RunLeft;
+    input = m_Input;
+    return true;
+}
+
+ReplayArchive::ReplayArchive(const fs::path& path)
+    : m_Archive(path) {
+    check_archive_header(m_Archive.bytes(), path);
+
+    const fs::path index_path = archive_index_path(path);
+    std::optional<ArchiveIndexHeader> header{};
+    if (fs::exists(index_path)) {
+        m_Index = MappedFile{index_path};
+        header = check_index(m_Index.bytes(), m_Archive.size());
+    }
+
+    if (!header) {
+        PG_LOG(Info, "rebuilding archive index - {}", index_path.string());
+        m_Index.close();
+        rebuild_archive_index(path);
+        m_Index = MappedFile{index_path};
+        header = check_index(m_Index.bytes(), m_Archive.size());
+        if (!header) {
+            throw std::runtime_error{std::format("Archive changed while it was indexed - {}", path.string())};
+        }
+    }
+
+    // the mapping is page aligned and the entries start on an 8 byte boundary
+    const uint8_t* entries = m_Index.bytes().data() + sizeof(ArchiveIndexHeader);
+    const uint8_t* by_seed = entries + (header->Count * sizeof(ArchiveEntry));
+    m_Entries = {reinterpret_cast<const ArchiveEntry*>(entries), header->Count};
+    m_BySeed = {reinterpret_cast<const uint32_t*>(by_seed), header->Count};
+}
+
+std::span<const ArchiveEntry> ReplayArchive::query(
+    uint8_t level,
+    ReplayOutcome outcome,
+    uint32_t max_ticks
+) const noexcept {
+    const auto key = [](const ArchiveEntry& entry) {
+        return std::tuple{entry.Level, entry.Outcome};
+    };
+    const auto [first, last] = std::ranges::equal_range(m_Entries, std::tuple{level, outcome}, {}, key);
+    const auto end = std::ranges::upper_bound(first, last, max_ticks, {}, &ArchiveEntry::TickCount);
+    return {first, end};
+}
+
+std::span<const uint32_t> ReplayArchive::find_seed(uint32_t seed) const noexcept {
+    const auto seed_of = [this](uint32_t index) { return m_Entries[index].Seed; };
+    const auto [first, last] = std::ranges::equal_range(m_BySeed, seed, {}, seed_of);
+    return {first, last};
+}
+
+ReplayHeader ReplayArchive::header(const ArchiveEntry& entry) const noexcept {
+    return read_record(m_Archive.bytes(), entry.Offset).Header;
+}
+
+ReplayInputStream ReplayArchive::inputs(const ArchiveEntry& entry) const noexcept {
+    return ReplayInputStream{m_Archive.bytes().subspan(entry.Offset + sizeof(ArchiveRecord), entry.PackedSize)};
+}
+
+Replay ReplayArchive::load(const ArchiveEntry& entry) const {
+    Replay replay{};
+    replay.Header = header(entry);
+    replay.Inputs.reserve(replay.Header.TickCount);
+
+    ReplayInputStream stream = inputs(entry);
+    TickInput input{};
+    while (stream.next(input)) {
+        replay.Inputs.push_back(input);
+    }
+
+    if (replay.Inputs.size() != replay.Header.TickCount) {
+        throw std::runtime_error{std::format(
+            "Corrupt archived replay (seed {}, {} of {} ticks)",
+            replay.Header.Seed,
+            replay.Inputs.size(),
+            replay.Header.TickCount
+        )};
+    }
+    return replay;
+}
+
+}  // namespace pill_game::game
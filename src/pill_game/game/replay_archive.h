@@ -0,0 +1,165 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+#include "pill_game/game/replay.h"
+#include "pill_game/util/mapped_file.h"
+
+namespace pill_game::game {
+
+// clang-format off
+constexpr uint32_t ARCHIVE_MAGIC           = 0x41524750;  // 'PGRA'
+constexpr uint32_t ARCHIVE_INDEX_MAGIC     = 0x49524750;  // 'PGRI'
+constexpr uint16_t ARCHIVE_VERSION         = 1;
+constexpr auto     ARCHIVE_EXTENSION       = std::string_view{".pga"};
+constexpr auto     ARCHIVE_INDEX_EXTENSION = std::string_view{".pgi"};
+// clang-format on
+
+enum class ReplayOutcome : uint8_t {
+    Lost = 0,
+    Won,
+};
+
+constexpr ReplayOutcome outcome_of(const ReplayHeader& header) noexcept {
+    return header.FinalEnemyCount == 0 ? ReplayOutcome::Won : ReplayOutcome::Lost;
+}
+
+struct ArchiveHeader {
+    uint32_t Magic{ARCHIVE_MAGIC};
+    uint16_t Version{ARCHIVE_VERSION};
+    uint16_t Reserved{0};
+};
+
+// Every replay in the archive is one of these followed by its packed inputs
+struct ArchiveRecord {
+    ReplayHeader Header{};
+    uint32_t PackedSize{0};
+};
+
+static_assert(sizeof(ArchiveHeader) == 8);
+static_assert(sizeof(ArchiveRecord) == sizeof(ReplayHeader) + 4);
+
+struct ArchiveIndexHeader {
+    uint32_t Magic{ARCHIVE_INDEX_MAGIC};
+    uint16_t Version{ARCHIVE_VERSION};
+    uint16_t Reserved{0};
+    uint64_t Count{0};
+    uint64_t ArchiveSize{0};  // archive bytes covered; anything else means the index is stale
+};
+
+// What a query can see of a replay without touching the archive
+struct ArchiveEntry {
+    uint64_t Offset{0};  // of the ArchiveRecord
+    uint32_t Seed{0};
+    uint32_t TickCount{0};
+    uint32_t PackedSize{0};
+    uint8_t Level{0};
+    ReplayOutcome Outcome{ReplayOutcome::Lost};
+    uint8_t Flags{0};
+    uint8_t Reserved{0};
+
+    double seconds() const noexcept { return static_cast<double>(TickCount) / SIM_TICK_RATE; }
+};
+
+static_assert(sizeof(ArchiveIndexHeader) == 24);
+static_assert(sizeof(ArchiveEntry) == 24);
+static_assert(std::is_trivially_copyable_v<ArchiveEntry>);
+
+//
+// Appends replays to an archive, creating it if needed. Inputs are stored as
+// runs of identical TickInputs (a varint length then the input), which takes
+// a typical game from 2 bytes a tick to a few hundred bytes in all. Keyframes
+// aren't archived; Replay::rebuild_keyframes() recreates them. finish() (or
+// the destructor) rebuilds the index to cover everything appended.
+//
+class ReplayArchiveWriter {
+   private:
+    fs::path m_Path;
+    std::ofstream m_File;
+    std::vector<uint8_t> m_Packed;
+    uint64_t m_Count{0};
+
+   public:
+    explicit ReplayArchiveWriter(const fs::path& path);
+    ~ReplayArchiveWriter() noexcept;
+
+   public:
+    ReplayArchiveWriter(const ReplayArchiveWriter&) = delete;
+    ReplayArchiveWriter& operator=(const ReplayArchiveWriter&) = delete;
+
+   public:
+    void append(const Replay& replay);
+
+    // Flushes the archive and rewrites its index; throws if either couldn't be written
+    void finish();
+
+    uint64_t count() const noexcept { return m_Count; }
+};
+
+//
+// Walks a replay's packed inputs straight out of the mapped archive; nothing
+// is copied or allocated.
+//
+class ReplayInputStream {
+   private:
+    const uint8_t* m_Next{nullptr};
+    const uint8_t* m_End{nullptr};
+    TickInput m_Input{};
+    uint32_t m_RunLeft{0};
+
+   public:
+    ReplayInputStream() = default;
+    explicit ReplayInputStream(std::span<const uint8_t> packed) noexcept
+        : m_Next(packed.data()),
+          m_End(packed.data() + packed.size()) {}
+
+   public:
+    // False once the inputs run out (or the packed data is malformed)
+    bool next(TickInput& input) noexcept;
+};
+
+//
+// Read side of an archive. Both the archive and its index are mapped, the
+// index being entries sorted by (level, outcome, ticks, seed) followed by a
+// permutation of them sorted by seed. A query is a binary search over the
+// mapped entries; replay bodies are only paged in when one is streamed.
+//
+// A missing or stale index (the archive has grown since it was written) is
+// rebuilt from the record headers on open.
+//
+class ReplayArchive {
+   private:
+    MappedFile m_Archive;
+    MappedFile m_Index;
+    std::span<const ArchiveEntry> m_Entries;
+    std::span<const uint32_t> m_BySeed;
+
+   public:
+    explicit ReplayArchive(const fs::path& path);  // throws std::runtime_error
+
+   public:
+    std::span<const ArchiveEntry> entries() const noexcept { return m_Entries; }
+
+    // Every 'outcome' game at 'level' that lasted at most 'max_ticks', shortest first
+    std::span<const ArchiveEntry> query(uint8_t level, ReplayOutcome outcome, uint32_t max_ticks) const noexcept;
+
+    // Indices into entries() of the games played from 'seed'
+    std::span<const uint32_t> find_seed(uint32_t seed) const noexcept;
+
+    ReplayHeader header(const ArchiveEntry& entry) const noexcept;
+    ReplayInputStream inputs(const ArchiveEntry& entry) const noexcept;
+    Replay load(const ArchiveEntry& entry) const;
+};
+
+fs::path archive_index_path(const fs::path& archive);
+
+// Scans the record headers and writes a fresh index next to the archive
+void rebuild_archive_index(const fs::path& archive);
+
+}  // namespace pill_game::game
@@ -0,0 +1,176 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/game/rollback.h"
+
+namespace pill_game::game {
+
+static_assert(MATCH_PLAYERS == 2, "remote_player() assumes a head to head match");
+
+void RollbackMatch::start(
+    PlayerId local_player,
+    uint32_t seed,
+    uint8_t level,
+    bool allow_pills,
+    bool allow_blocks,
+    MatchRule rule
+) noexcept {
+    // both players get the same board, piece sequence and rule
+    for (GameSession& session : m_State.Sessions) {
+        session.start(seed, level, allow_pills, allow_blocks, rule);
+    }
+
+    m_Inputs.fill(MatchInput{});
+    m_Received.fill(0);
+    m_RemoteAck = 0;
+    m_Tick = 0;
+    m_RollbackFrom = NO_ROLLBACK;
+    m_LocalPlayer = local_player;
+    m_Stats = RollbackStats{};
+}
+
+bool RollbackMatch::can_advance() const noexcept {
+    if (m_Tick >= m_Received.at(remote_player()) + ROLLBACK_MAX_TICKS) {
+        return false;
+    }
+
+    // every input the remote hasn't confirmed must still be there to resend
+    return m_Tick < m_RemoteAck + INPUT_HISTORY_SIZE;
+}
+
+bool RollbackMatch::advance(const TickInput& local_input) noexcept {
+    if (!can_advance()) {
+        ++m_Stats.StalledTicks;
+        return false;
+    }
+
+    synchronise();
+
+    input(m_Tick, m_LocalPlayer) = local_input;
+    m_Received.at(m_LocalPlayer) = m_Tick + 1;
+
+    simulate(m_Tick);
+    ++m_Tick;
+    return true;
+}
+
+void RollbackMatch::receive(const InputPacket& packet) noexcept {
+    if (packet.Player != remote_player()) {
+        return;
+    }
+
+    m_RemoteAck = std::max(m_RemoteAck, packet.AckTick);
+
+    uint64_t& received = m_Received.at(packet.Player);
+    for (uint32_t i = 0; i < packet.Count; ++i) {
+        const uint64_t tick = packet.FirstTick + i;
+        if (tick < received) {
+            continue;  // resent, already have it
+        }
+
+        // gaps can't be filled in; the next packet starts from our ack again
+        if (tick > received || tick >= m_Tick + ROLLBACK_MAX_TICKS) {
+            break;
+        }
+
+        const TickInput& actual = packet.Inputs.at(i);
+        TickInput& stored = input(tick, packet.Player);
+
+        // already simulated with a guess; rewind if it was a wrong one
+        if (tick < m_Tick && stored != actual) {
+            m_RollbackFrom = std::min(m_RollbackFrom, tick);
+        }
+
+        stored = actual;
+        ++received;
+    }
+}
+
+InputPacket RollbackMatch::make_packet() const noexcept {
+    InputPacket packet{};
+    packet.Player = m_LocalPlayer;
+    packet.AckTick = m_Received.at(remote_player());
+    packet.FirstTick = m_RemoteAck;
+
+    const uint64_t unacked = m_Received.at(m_LocalPlayer) - m_RemoteAck;
+    packet.Count = static_cast<uint8_t>(std::min<uint64_t>(unacked, INPUT_PACKET_CAPACITY));
+
+    for (uint32_t i = 0; i < packet.Count; ++i) {
+        packet.Inputs.at(i) = m_Inputs.at((packet.FirstTick + i) % INPUT_HISTORY_SIZE).at(m_LocalPlayer);
+    }
+    return packet;
+}
+
+void RollbackMatch::synchronise() noexcept {
+    if (m_RollbackFrom == NO_ROLLBACK) {
+        return;
+    }
+
+    const uint64_t from = std::exchange(m_RollbackFrom, NO_ROLLBACK);
+    assert(from < m_Tick && from + ROLLBACK_RING_SIZE > m_Tick);
+
+    m_State = m_Snapshots.at(from % ROLLBACK_RING_SIZE);
+    for (uint64_t tick = from; tick < m_Tick; ++tick) {
+        simulate(tick);
+    }
+
+    const auto depth = static_cast<uint32_t>(m_Tick - from);
+    ++m_Stats.Rollbacks;
+    m_Stats.ResimulatedTicks += depth;
+    m_Stats.MaxRollbackTicks = std::max(m_Stats.MaxRollbackTicks, depth);
+}
+
+uint64_t RollbackMatch::confirmed_tick() const noexcept {
+    return std::min({m_Tick, m_Received.at(0), m_Received.at(1)});
+}
+
+TickInput& RollbackMatch::input(uint64_t tick, PlayerId player) noexcept {
+    return m_Inputs.at(tick % INPUT_HISTORY_SIZE).at(player);
+}
+
+TickInput RollbackMatch::predict(PlayerId player) noexcept {
+    const uint64_t received = m_Received.at(player);
+    if (received == 0) {
+        return TickInput{};
+    }
+
+    // keep holding whatever was held, but don't invent new presses
+    return TickInput{input(received - 1, player).Held, 0};
+}
+
+void RollbackMatch::simulate(uint64_t tick) noexcept {
+    m_Snapshots.at(tick % ROLLBACK_RING_SIZE) = m_State;
+
+    for (PlayerId player = 0; player < MATCH_PLAYERS; ++player) {
+        TickInput& tick_input = input(tick, player);
+        if (tick >= m_Received.at(player)) {
+            tick_input = predict(player);
+        }
+        m_State.Sessions.at(player).tick(tick_input);
+    }
+}
+
+uint64_t session_checksum(const GameSession& session) noexcept {
+    // FNV-1a
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    const auto mix = [&hash](uint64_t value) {
+        hash ^= value;
+        hash *= 0x100000001b3ULL;
+    };
+
+    for (const BoardEntity& ent : session.Board.flat_game_board()) {
+        mix(std::bit_cast<uint8_t>(ent));
+    }
+    mix(session.Ticks);
+    mix(session.Score);
+    mix(static_cast<uint64_t>(session.Piece.Row));
+    mix(static_cast<uint64_t>(session.Piece.Column));
+    mix(static_cast<uint64_t>(session.Finished));
+    return hash;
+}
+
+}  // namespace pill_game::game
@@ -0,0 +1,105 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+#include "pill_game/game/game_session.h"
+
+namespace pill_game::game {
+
+// clang-format off
+constexpr uint32_t MATCH_PLAYERS          = 2;
+constexpr uint32_t ROLLBACK_MAX_TICKS     = 10;  // furthest a peer may run ahead of its inputs
+constexpr uint32_t ROLLBACK_RING_SIZE     = 16;  // snapshots kept; must cover ROLLBACK_MAX_TICKS
+constexpr uint32_t INPUT_HISTORY_SIZE     = 64;  // inputs kept for resending and comparing
+constexpr uint32_t INPUT_PACKET_CAPACITY  = 32;
+// clang-format on
+
+static_assert(ROLLBACK_RING_SIZE > ROLLBACK_MAX_TICKS);
+static_assert(INPUT_HISTORY_SIZE >= ROLLBACK_RING_SIZE);
+
+using PlayerId = uint8_t;
+using MatchInput = std::array<TickInput, MATCH_PLAYERS>;
+
+// Everything a rollback has to restore; one session per player
+struct MatchState {
+    std::array<GameSession, MATCH_PLAYERS> Sessions;
+};
+
+static_assert(std::is_trivially_copyable_v<MatchState>);
+
+// A peer's recent inputs; sent every tick so a lost packet is covered by the next
+struct InputPacket {
+    PlayerId Player{0};
+    uint8_t Count{0};
+    uint64_t FirstTick{0};
+    uint64_t AckTick{0};  // inputs from the receiver held up to (not including) this tick
+    std::array<TickInput, INPUT_PACKET_CAPACITY> Inputs{};
+};
+
+struct RollbackStats {
+    uint64_t Rollbacks{0};
+    uint64_t ResimulatedTicks{0};
+    uint32_t MaxRollbackTicks{0};
+    uint64_t StalledTicks{0};  // advance() refused, too far ahead of the remote
+};
+
+//
+// GGPO style rollback for a head to head match. Each peer simulates every
+// player's session, predicting the remote player's input (last held buttons,
+// no new presses) until the real input arrives. When a prediction turns out
+// wrong the match restores the snapshot from before that tick and simulates
+// forward again with the corrected input.
+//
+// Sessions are plain data so a snapshot is a straight copy of MatchState.
+//
+class RollbackMatch {
+   private:
+    static constexpr uint64_t NO_ROLLBACK = std::numeric_limits<uint64_t>::max();
+
+    MatchState m_State;
+    std::array<MatchState, ROLLBACK_RING_SIZE> m_Snapshots;  // state before tick t at t % size
+    std::array<MatchInput, INPUT_HISTORY_SIZE> m_Inputs{};     // input used for tick t
+
+    std::array<uint64_t, MATCH_PLAYERS> m_Received{};  // inputs for ticks below this are confirmed
+    uint64_t m_RemoteAck{0};  // our inputs the remote has confirmed it holds
+    uint64_t m_Tick{0};
+    uint64_t m_RollbackFrom{NO_ROLLBACK};
+    PlayerId m_LocalPlayer{0};
+    RollbackStats m_Stats{};
+
+   public:
+    void start(PlayerId local_player, uint32_t seed, uint8_t level, bool allow_pills, bool allow_blocks, MatchRule rule) noexcept;
+
+    // False (and nothing happens) while the remote is too far behind
+    bool can_advance() const noexcept;
+    bool advance(const TickInput& local_input) noexcept;
+
+    void receive(const InputPacket& packet) noexcept;
+    InputPacket make_packet() const noexcept;
+
+    // Re-simulates now if a late input contradicted a prediction
+    void synchronise() noexcept;
+
+    const MatchState& state() const noexcept { return m_State; }
+    const GameSession& session(PlayerId player) const noexcept { return m_State.Sessions.at(player); }
+    PlayerId remote_player() const noexcept { return static_cast<PlayerId>(1 - m_LocalPlayer); }
+    uint64_t tick() const noexcept { return m_Tick; }
+    uint64_t confirmed_tick() const noexcept;
+    const RollbackStats& stats() const noexcept { return m_Stats; }
+
+   private:
+    TickInput& input(uint64_t tick, PlayerId player) noexcept;
+    TickInput predict(PlayerId player) noexcept;
+    void simulate(uint64_t tick) noexcept;
+};
+
+// Hash of the gameplay visible parts of a session, for comparing peers
+uint64_t session_checksum(const GameSession& session) noexcept;
+
+}  // namespace pill_game::game
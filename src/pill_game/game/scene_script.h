@@ -0,0 +1,109 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+#include "pill_game/game/game_renderer.h"
+
+namespace pill_game::game {
+
+//
+// Awaitables for scene scripts (Tasks started with start_scene_task). A
+// suspended script is either in the scene scheduler or on a signal's wait
+// list, so it costs nothing per frame until it is resumed.
+//
+// Gameplay timing stays on the GameSession's own scheduler; coroutine frames
+// can't be copied into replays or snapshots.
+//
+
+struct WaitTicks {
+    uint32_t Ticks{1};
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle) const noexcept { schedule_after(Ticks, handle); }
+    void await_resume() const noexcept {}
+};
+
+// co_await wait_ticks(n) resumes after 'n' scene ticks; paused time doesn't count
+inline WaitTicks wait_ticks(uint32_t ticks) noexcept {
+    return WaitTicks{ticks};
+}
+
+//
+// Something scripts can wait for; notify() resumes every script waiting at
+// that moment. Waiters are linked through their own coroutine frames, so
+// waiting never allocates.
+//
+class SceneSignal {
+   public:
+    class Awaiter {
+        friend SceneSignal;
+
+       private:
+        SceneSignal& m_Signal;
+        std::coroutine_handle<> m_Handle{};
+        Awaiter* m_Next{nullptr};
+        bool m_Linked{false};
+
+       public:
+        explicit Awaiter(SceneSignal& signal) noexcept : m_Signal(signal) {}
+        ~Awaiter() noexcept { m_Signal.unlink(this); }  // script destroyed mid-wait
+
+        Awaiter(const Awaiter&) = delete;
+        Awaiter& operator=(const Awaiter&) = delete;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) noexcept {
+            m_Handle = handle;
+            m_Next = m_Signal.m_Waiters;
+            m_Linked = true;
+            m_Signal.m_Waiters = this;
+        }
+        void await_resume() const noexcept {}
+    };
+
+   private:
+    Awaiter* m_Waiters{nullptr};
+
+   public:
+    SceneSignal() = default;
+    ~SceneSignal() noexcept = default;
+
+    SceneSignal(const SceneSignal&) = delete;
+    SceneSignal& operator=(const SceneSignal&) = delete;
+
+   public:
+    Awaiter operator co_await() noexcept { return Awaiter{*this}; }
+
+    void notify() {
+        // detach first; resumed scripts may wait on this signal again
+        Awaiter* waiter = std::exchange(m_Waiters, nullptr);
+        while (waiter != nullptr) {
+            Awaiter* next = waiter->m_Next;
+            waiter->m_Linked = false;
+            waiter->m_Handle.resume();
+            waiter = next;
+        }
+    }
+
+   private:
+    void unlink(Awaiter* awaiter) noexcept {
+        if (!awaiter->m_Linked) {
+            return;
+        }
+        for (Awaiter** link = &m_Waiters; *link != nullptr; link = &(*link)->m_Next) {
+            if (*link == awaiter) {
+                *link = awaiter->m_Next;
+                awaiter->m_Linked = false;
+                return;
+            }
+        }
+    }
+};
+
+}  // namespace pill_game::game
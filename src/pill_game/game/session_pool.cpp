@@ -0,0 +1,61 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/game/session_pool.h"
+
+namespace pill_game::game {
+
+SessionPool::SessionPool(size_t capacity)
+    : m_Sessions(capacity),
+      m_Inputs(capacity),
+      m_Active(capacity, 0) {
+    m_FreeList.reserve(capacity);
+
+    // hand out low ids first
+    for (size_t i = capacity; i > 0; --i) {
+        m_FreeList.push_back(static_cast<SessionId>(i - 1));
+    }
+}
+
+std::optional<SessionId> SessionPool::create(
+    uint32_t seed,
+    uint8_t level,
+    bool allow_pills,
+    bool allow_blocks,
+    MatchRule rule
+) noexcept {
+    if (m_FreeList.empty()) {
+        return std::nullopt;
+    }
+
+    const SessionId id = m_FreeList.back();
+    m_FreeList.pop_back();
+
+    m_Sessions.at(id).start(seed, level, allow_pills, allow_blocks, rule);
+    m_Inputs.at(id) = TickInput{};
+    m_Active.at(id) = 1;
+    return id;
+}
+
+void SessionPool::destroy(SessionId id) noexcept {
+    if (id >= m_Active.size() || m_Active.at(id) == 0) {
+        return;
+    }
+    m_Active.at(id) = 0;
+    m_FreeList.push_back(id);
+}
+
+void SessionPool::tick_all() noexcept {
+    for (size_t i = 0; i < m_Sessions.size(); ++i) {
+        if (m_Active[i] != 0) {
+            m_Sessions[i].tick(m_Inputs[i]);
+            m_Inputs[i].next_tick();
+        }
+    }
+}
+
+}  // namespace pill_game::game
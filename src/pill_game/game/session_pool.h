@@ -0,0 +1,56 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+#include "pill_game/game/game_session.h"
+
+namespace pill_game::game {
+
+using SessionId = uint32_t;
+
+//
+// Fixed capacity, contiguous storage for many independent sessions along
+// with the input that feeds each one. Sessions never move once
+// created so references stay valid until they are destroyed.
+//
+class SessionPool {
+   private:
+    std::vector<GameSession> m_Sessions;
+    std::vector<TickInput> m_Inputs;
+    std::vector<uint8_t> m_Active;
+    std::vector<SessionId> m_FreeList;
+
+   public:
+    explicit SessionPool(size_t capacity);
+    ~SessionPool() noexcept = default;
+
+   public:
+    SessionPool(const SessionPool&) = delete;
+    SessionPool& operator=(const SessionPool&) = delete;
+    SessionPool(SessionPool&&) noexcept = default;
+    SessionPool& operator=(SessionPool&&) noexcept = default;
+
+   public:
+    std::optional<SessionId> create(uint32_t seed, uint8_t level, bool allow_pills, bool allow_blocks, MatchRule rule) noexcept;
+    void destroy(SessionId id) noexcept;
+
+    // Ticks every active session once with its current input
+    void tick_all() noexcept;
+
+   public:
+    GameSession& session(SessionId id) { return m_Sessions.at(id); }
+    const GameSession& session(SessionId id) const { return m_Sessions.at(id); }
+    TickInput& input(SessionId id) { return m_Inputs.at(id); }
+    bool is_active(SessionId id) const { return m_Active.at(id) != 0; }
+
+    size_t capacity() const noexcept { return m_Sessions.size(); }
+    size_t active_count() const noexcept { return m_Sessions.size() - m_FreeList.size(); }
+};
+
+}  // namespace pill_game::game
@@ -0,0 +1,145 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/game/simulation_thread.h"
+
+#include "pill_game/util/alloc_tracker.h"
+
+namespace pill_game::game {
+
+uint64_t sim_clock_ns(void) noexcept {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        )
+            .count()
+    );
+}
+
+SimulationThread::~SimulationThread() noexcept {
+    stop();
+}
+
+void SimulationThread::start() {
+    if (m_Running.exchange(true)) {
+        return;
+    }
+    m_Thread = std::thread([this]() { run(); });
+}
+
+void SimulationThread::stop() noexcept {
+    m_Running.store(false, std::memory_order_release);
+    if (m_Thread.joinable()) {
+        m_Thread.join();
+    }
+}
+
+uint32_t SimulationThread::start_game(const GameSettings& settings) {
+    std::scoped_lock lock{m_CommandMutex};
+    m_PendingGame = settings;
+    m_PendingGameId = ++m_LastGameId;
+    m_HasPendingGame.store(true, std::memory_order_release);
+    return m_PendingGameId;
+}
+
+void SimulationThread::push_input(const InputEvent& event) noexcept {
+    if (!m_Inputs.try_push(event)) {
+        PG_LOG(Warn, "input queue is full; dropping input");
+    }
+}
+
+void SimulationThread::run() noexcept {
+    memory::set_phase(memory::Simulation);
+    uint64_t next_tick_ns = sim_clock_ns();
+
+    while (m_Running.load(std::memory_order_acquire)) {
+        if (m_HasPendingGame.load(std::memory_order_acquire)) {
+            apply_pending_game();
+        }
+
+        const uint64_t now_ns = sim_clock_ns();
+        if (now_ns < next_tick_ns) {
+            std::this_thread::sleep_for(std::chrono::nanoseconds{next_tick_ns - now_ns});
+            continue;
+        }
+
+        // too far behind (debugger, suspended process); drop the missed ticks
+        if (now_ns - next_tick_ns > SIM_TICK_NS * MAX_CATCHUP_TICKS) {
+            next_tick_ns = now_ns;
+        }
+
+        drain_inputs(next_tick_ns);
+
+        const bool paused = m_Paused.load(std::memory_order_relaxed);
+        if (!paused && m_GameId != 0 && !m_Session.Finished) {
+            m_Recording.record(m_Session, m_Input);
+            m_Session.tick(m_Input);
+            if (m_Session.Finished) {
+                finish_game();
+            }
+        }
+        m_Input.next_tick();
+
+        publish(now_ns);
+        next_tick_ns += SIM_TICK_NS;
+    }
+}
+
+void SimulationThread::apply_pending_game() {
+    GameSettings settings{};
+    {
+        std::scoped_lock lock{m_CommandMutex};
+        settings = m_PendingGame;
+        m_GameId = m_PendingGameId;
+        m_HasPendingGame.store(false, std::memory_order_relaxed);
+    }
+
+    m_Session.start(settings.Seed, settings.Level, settings.AllowPills, settings.AllowBlocks, settings.Rule);
+    m_Recording.begin(m_Session);
+}
+
+void SimulationThread::drain_inputs(uint64_t deadline_ns) noexcept {
+    // inputs after this tick's deadline stay queued for the tick they belong to
+    while (const InputEvent* event = m_Inputs.peek()) {
+        if (event->TimestampNs > deadline_ns) {
+            break;
+        }
+        m_Input.apply(*event);
+        m_LastInputNs = event->TimestampNs;
+        m_Inputs.pop();
+    }
+}
+
+void SimulationThread::finish_game() noexcept {
+    m_Recording.finish(m_Session);
+
+    // recording is opt-in; create the directory to start collecting replays
+    try {
+        const fs::path replay_dir = fs::current_path() / "replays";
+        if (!fs::is_directory(replay_dir)) {
+            return;
+        }
+
+        save_replay(
+            m_Recording,
+            replay_dir / std::format("{}_{}{}", m_Session.Level, m_Session.Seed, REPLAY_EXTENSION)
+        );
+    } catch (const std::exception& ex) {
+        PG_LOG(Warn, "Failed to save replay - {}", ex.what());
+    }
+}
+
+void SimulationThread::publish(uint64_t now_ns) noexcept {
+    SessionSnapshot& snapshot = m_Snapshots.back();
+    snapshot.Session = m_Session;
+    snapshot.GameId = m_GameId;
+    snapshot.PublishedNs = now_ns;
+    snapshot.LastInputNs = m_LastInputNs;
+    m_Snapshots.publish();
+}
+
+}  // namespace pill_game::game
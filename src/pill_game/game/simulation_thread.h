@@ -0,0 +1,100 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+#include "pill_game/game/game_session.h"
+#include "pill_game/game/replay.h"
+#include "pill_game/util/spsc_queue.h"
+#include "pill_game/util/triple_buffer.h"
+
+namespace pill_game::game {
+
+// clang-format off
+constexpr uint64_t SIM_TICK_NS          = 1'000'000'000ULL / SIM_TICK_RATE;
+constexpr uint32_t MAX_CATCHUP_TICKS    = 10;   // past this, ticks are dropped
+constexpr size_t   INPUT_QUEUE_CAPACITY = 256;
+// clang-format on
+
+// Monotonic clock used by the simulation and for input timestamps
+uint64_t sim_clock_ns(void) noexcept;
+
+// What the renderer gets to see of the game; written only by the simulation
+struct SessionSnapshot {
+    GameSession Session;
+    uint32_t GameId{0};  // 0 until the first game starts
+    uint64_t PublishedNs{0};
+    uint64_t LastInputNs{0};  // newest input event this snapshot has taken in
+};
+
+struct GameSettings {
+    uint32_t Seed{0};
+    uint8_t Level{20};
+    bool AllowPills{true};
+    bool AllowBlocks{false};
+    MatchRule Rule{MatchRule::Lines};
+};
+
+//
+// Runs the GameSession on its own thread at SIM_TICK_RATE so that slow frames
+// (e.g. a stalled SDL_RenderPresent) don't delay the game, and vice versa.
+// Inputs go in through a lock-free queue, snapshots come out through a
+// triple buffer; neither thread ever blocks the other.
+//
+class SimulationThread {
+   private:
+    std::thread m_Thread;
+    std::atomic<bool> m_Running{false};
+    std::atomic<bool> m_Paused{false};
+
+    SpscQueue<InputEvent, INPUT_QUEUE_CAPACITY> m_Inputs;
+    TripleBuffer<SessionSnapshot> m_Snapshots;
+
+    std::mutex m_CommandMutex;
+    std::atomic<bool> m_HasPendingGame{false};
+    GameSettings m_PendingGame{};
+    uint32_t m_PendingGameId{0};
+    uint32_t m_LastGameId{0};  // render thread only
+
+    // simulation thread only
+    GameSession m_Session;
+    Replay m_Recording{};
+    TickInput m_Input{};
+    uint64_t m_LastInputNs{0};
+    uint32_t m_GameId{0};
+
+   public:
+    SimulationThread() = default;
+    ~SimulationThread() noexcept;
+
+   public:
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+    SimulationThread(SimulationThread&&) = delete;
+    SimulationThread& operator=(SimulationThread&&) = delete;
+
+   public:
+    void start();
+    void stop() noexcept;
+
+    // Render thread; the game begins on the next simulation tick. Returns the
+    // id that snapshots of the new game will carry.
+    uint32_t start_game(const GameSettings& settings);
+    void push_input(const InputEvent& event) noexcept;
+    void set_paused(bool paused) noexcept { m_Paused.store(paused, std::memory_order_relaxed); }
+    const SessionSnapshot& latest() noexcept { return m_Snapshots.acquire(); }
+
+   private:
+    void run() noexcept;
+    void apply_pending_game();
+    void drain_inputs(uint64_t deadline_ns) noexcept;
+    void finish_game() noexcept;
+    void publish(uint64_t now_ns) noexcept;
+};
+
+}  // namespace pill_game::game
@@ -0,0 +1,95 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/game/sprite_batch.h"
+
+#include "pill_game/game/game_renderer.h"
+
+namespace pill_game::game {
+
+SpriteBatch::SpriteBatch(
+    SDL_Texture* texture,
+    float texture_width,
+    float texture_height,
+    size_t quad_capacity,
+    std::pmr::memory_resource* resource
+)
+    : m_Vertices(resource),
+      m_Indices(resource),
+      m_Texture(texture),
+      m_InvTextureWidth(1.0F / texture_width),
+      m_InvTextureHeight(1.0F / texture_height) {
+    m_Vertices.reserve(quad_capacity * 4);
+    m_Indices.reserve(quad_capacity * 6);
+}
+
+void SpriteBatch::add(const SDL_FRect& src, const SDL_FRect& dst, uint32_t colour, uint8_t rotation) noexcept {
+    const Colour c{colour};
+    add(
+        src,
+        dst,
+        SDL_FColor{
+            static_cast<float>(c.Red) / 255.0F,
+            static_cast<float>(c.Green) / 255.0F,
+            static_cast<float>(c.Blue) / 255.0F,
+            static_cast<float>(c.Alpha) / 255.0F,
+        },
+        rotation
+    );
+}
+
+void SpriteBatch::add(const SDL_FRect& src, const SDL_FRect& dst, const SDL_FColor& colour, uint8_t rotation) noexcept {
+    const float u0 = src.x * m_InvTextureWidth;
+    const float v0 = src.y * m_InvTextureHeight;
+    const float u1 = (src.x + src.w) * m_InvTextureWidth;
+    const float v1 = (src.y + src.h) * m_InvTextureHeight;
+
+    // corners clockwise from the top left; rotating the image clockwise moves
+    // texture corner i onto destination corner i + rotation
+    const std::array<SDL_FPoint, 4> positions{
+        SDL_FPoint{        dst.x,         dst.y},
+        SDL_FPoint{dst.x + dst.w,         dst.y},
+        SDL_FPoint{dst.x + dst.w, dst.y + dst.h},
+        SDL_FPoint{        dst.x, dst.y + dst.h},
+    };
+    const std::array<SDL_FPoint, 4> uvs{
+        SDL_FPoint{u0, v0},
+        SDL_FPoint{u1, v0},
+        SDL_FPoint{u1, v1},
+        SDL_FPoint{u0, v1},
+    };
+
+    const auto base = static_cast<int>(m_Vertices.size());
+    for (size_t i = 0; i < positions.size(); ++i) {
+        const size_t uv = (i + 4U - (rotation % 4U)) % 4U;
+        m_Vertices.push_back(SDL_Vertex{positions.at(i), colour, uvs.at(uv)});
+    }
+
+    for (int index : {0, 1, 2, 0, 2, 3}) {
+        m_Indices.push_back(base + index);
+    }
+}
+
+void SpriteBatch::flush(SDL_Renderer* renderer) noexcept {
+    if (m_Vertices.empty()) {
+        return;
+    }
+
+    SDL_RenderGeometry(
+        renderer,
+        m_Texture,
+        m_Vertices.data(),
+        static_cast<int>(m_Vertices.size()),
+        m_Indices.data(),
+        static_cast<int>(m_Indices.size())
+    );
+
+    m_Vertices.clear();
+    m_Indices.clear();
+}
+
+}  // namespace pill_game::game
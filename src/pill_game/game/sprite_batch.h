@@ -0,0 +1,48 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+#include <memory_resource>
+
+#include "SDL3/SDL.h"
+
+namespace pill_game::game {
+
+//
+// Collects textured quads for a single texture and submits them with one
+// SDL_RenderGeometry call. Vertex storage comes from the given resource,
+// normally the frame arena, so building a batch doesn't touch the heap.
+//
+class SpriteBatch {
+   private:
+    std::pmr::vector<SDL_Vertex> m_Vertices;
+    std::pmr::vector<int> m_Indices;
+    SDL_Texture* m_Texture{nullptr};
+    float m_InvTextureWidth{0.0F};
+    float m_InvTextureHeight{0.0F};
+
+   public:
+    SpriteBatch(
+        SDL_Texture* texture,
+        float texture_width,
+        float texture_height,
+        size_t quad_capacity,
+        std::pmr::memory_resource* resource
+    );
+
+   public:
+    // 'rotation' is in 90 degree clockwise steps, about the quad centre
+    void add(const SDL_FRect& src, const SDL_FRect& dst, uint32_t colour, uint8_t rotation = 0) noexcept;
+    void add(const SDL_FRect& src, const SDL_FRect& dst, const SDL_FColor& colour, uint8_t rotation = 0) noexcept;
+    void flush(SDL_Renderer* renderer) noexcept;
+
+    size_t quad_count() const noexcept { return m_Vertices.size() / 4; }
+};
+
+}  // namespace pill_game::game
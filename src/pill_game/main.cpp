@@ -5,9 +5,124 @@
 #include "vendor/stb_truetype.h"
 
 #include "game/game_renderer.h"
+#include "bench/archive_benchmark.h"
+#include "bench/board_benchmark.h"
+#include "bench/corpus_benchmark.h"
+#include "bench/large_board_benchmark.h"
+#include "bench/mode_benchmark.h"
+#include "bench/packing_benchmark.h"
+#include "bench/replay_benchmark.h"
+#include "bench/rollback_benchmark.h"
+#include "bench/session_benchmark.h"
+#include "bench/spectator_benchmark.h"
+#include "game/level_corpus.h"
 
 using namespace pill_game;
 
-int main() {
-    return game::run_application();
+namespace {
+
+uint32_t parse_u32(std::string_view str, uint32_t fallback) noexcept {
+    uint32_t value{fallback};
+    std::from_chars(str.data(), str.data() + str.size(), value);
+    return value;
+}
+
+}  // namespace
+
+//
+// pill_game [--corpus <file>] ...             ; boards come from a level corpus
+// pill_game [--rules <lines|clusters|shapes>] ... ; what breaks in play, lines by default; benchmarks play lines
+// pill_game                                   ; play the game
+// pill_game --bench-replays <dir> [threads]   ; headless replay benchmark
+// pill_game --bench-sessions <count>          ; many sessions in one process
+// pill_game --bench-rollback [latency] [loss%] ; rollback over a loopback link
+// pill_game --bench-spectators [count]        ; spectator stream size and speed
+// pill_game --bench-packing [count]           ; packed boards and position files
+// pill_game --bench-boards [count]            ; board generation rate
+// pill_game --bench-modes [games]             ; classic, sprint and marathon boards
+// pill_game --bench-large-boards [max width]  ; runtime sized boards against fixed
+// pill_game --build-corpus <file> [per set]   ; pre-generate a level corpus
+// pill_game --bench-corpus <file>             ; corpus boards against generated
+// pill_game --archive-replays <dir> <archive> ; append replays to an archive
+// pill_game --query-archive <archive> <level> <won|lost> [max seconds]
+//
+int main(int argc, char** argv) {
+    std::vector<std::string_view> args(argv, argv + argc);
+
+    std::optional<game::LevelCorpus> corpus{};
+    if (args.size() >= 3 && args.at(1) == "--corpus") {
+        try {
+            corpus.emplace(args.at(2));
+        } catch (const std::exception& ex) {
+            PG_LOG(Err, "{}", ex.what());
+            return -1;
+        }
+        game::set_level_corpus(&*corpus);
+        args.erase(args.begin() + 1, args.begin() + 3);
+    }
+
+    MatchRule rule{MatchRule::Lines};
+    if (args.size() >= 3 && args.at(1) == "--rules") {
+        if (!parse_match_rule(args.at(2), rule)) {
+            PG_LOG(Err, "unknown match rule - {}", args.at(2));
+            return -1;
+        }
+        args.erase(args.begin() + 1, args.begin() + 3);
+    }
+
+    if (args.size() >= 3 && args.at(1) == "--bench-replays") {
+        const uint32_t threads = args.size() >= 4 ? parse_u32(args.at(3), 0) : 0;
+        return bench::run_replay_benchmark(args.at(2), threads);
+    }
+
+    if (args.size() >= 3 && args.at(1) == "--bench-sessions") {
+        return bench::run_session_benchmark(parse_u32(args.at(2), 1000));
+    }
+
+    if (args.size() >= 2 && args.at(1) == "--bench-rollback") {
+        const uint32_t latency = args.size() >= 3 ? parse_u32(args.at(2), 4) : 4;
+        const uint32_t loss = args.size() >= 4 ? parse_u32(args.at(3), 5) : 5;
+        return bench::run_rollback_benchmark(latency, loss);
+    }
+
+    if (args.size() >= 2 && args.at(1) == "--bench-spectators") {
+        return bench::run_spectator_benchmark(args.size() >= 3 ? parse_u32(args.at(2), 256) : 256);
+    }
+
+    if (args.size() >= 2 && args.at(1) == "--bench-packing") {
+        return bench::run_packing_benchmark(args.size() >= 3 ? parse_u32(args.at(2), 1 << 20) : 1 << 20);
+    }
+
+    if (args.size() >= 2 && args.at(1) == "--bench-boards") {
+        return bench::run_board_benchmark(args.size() >= 3 ? parse_u32(args.at(2), 1 << 20) : 1 << 20);
+    }
+
+    if (args.size() >= 2 && args.at(1) == "--bench-modes") {
+        return bench::run_mode_benchmark(args.size() >= 3 ? parse_u32(args.at(2), 200) : 200);
+    }
+
+    if (args.size() >= 2 && args.at(1) == "--bench-large-boards") {
+        return bench::run_large_board_benchmark(args.size() >= 3 ? parse_u32(args.at(2), 256) : 256);
+    }
+
+    if (args.size() >= 3 && args.at(1) == "--build-corpus") {
+        return bench::run_corpus_build(args.at(2), args.size() >= 4 ? parse_u32(args.at(3), 1024) : 1024);
+    }
+
+    if (args.size() >= 3 && args.at(1) == "--bench-corpus") {
+        return bench::run_corpus_benchmark(args.at(2));
+    }
+
+    if (args.size() >= 4 && args.at(1) == "--archive-replays") {
+        return bench::run_archive_import(args.at(2), args.at(3));
+    }
+
+    if (args.size() >= 5 && args.at(1) == "--query-archive") {
+        const auto level = static_cast<uint8_t>(parse_u32(args.at(3), 0));
+        const auto outcome = args.at(4) == "won" ? game::ReplayOutcome::Won : game::ReplayOutcome::Lost;
+        const uint32_t max_seconds = args.size() >= 6 ? parse_u32(args.at(5), 3600) : 3600;
+        return bench::run_archive_query(args.at(2), level, outcome, max_seconds);
+    }
+
+    return game::run_application(rule);
 }
@@ -0,0 +1,116 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+namespace pill_game::net {
+
+//
+// Packs fields of up to 32 bits into bytes, least significant bit first,
+// through a 64 bit accumulator. The caller sizes the buffer for its largest
+// message; writing past the end is a bug and asserts.
+//
+class BitWriter {
+   private:
+    std::span<uint8_t> m_Buffer;
+    size_t m_Size{0};      // whole bytes written
+    uint64_t m_Pending{0};  // bits not yet written, lowest first
+    uint32_t m_PendingBits{0};
+
+   public:
+    explicit BitWriter(std::span<uint8_t> buffer) noexcept : m_Buffer(buffer) {}
+
+   public:
+    void put(uint32_t value, uint32_t bits) noexcept {
+        assert(bits <= 32);
+        m_Pending |= (value & ((uint64_t{1} << bits) - 1)) << m_PendingBits;
+        m_PendingBits += bits;
+        while (m_PendingBits >= 8) {
+            assert(m_Size < m_Buffer.size());
+            m_Buffer[m_Size++] = static_cast<uint8_t>(m_Pending);
+            m_Pending >>= 8U;
+            m_PendingBits -= 8;
+        }
+    }
+
+    void put_bit(bool value) noexcept { put(value ? 1U : 0U, 1); }
+
+    // Elias gamma code for value >= 1; small numbers take few bits (1 -> 1 bit, 2..3 -> 3 bits)
+    void put_gamma(uint32_t value) noexcept {
+        assert(value >= 1);
+        const auto width = static_cast<uint32_t>(std::bit_width(value)) - 1;
+        put(1U << width, width + 1);  // 'width' zeros then a one
+        put(value, width);            // the leading one is implied
+    }
+
+    // Writes out the last partial byte; returns the message size
+    size_t finish() noexcept {
+        if (m_PendingBits > 0) {
+            put(0, 8 - m_PendingBits);
+        }
+        return m_Size;
+    }
+
+    size_t bits() const noexcept { return (m_Size * 8) + m_PendingBits; }
+};
+
+// Reads fields back out; every get fails once the buffer runs out
+class BitReader {
+   private:
+    std::span<const uint8_t> m_Buffer;
+    size_t m_Offset{0};
+    uint64_t m_Pending{0};
+    uint32_t m_PendingBits{0};
+
+   public:
+    explicit BitReader(std::span<const uint8_t> buffer) noexcept : m_Buffer(buffer) {}
+
+   public:
+    bool get(uint32_t& out, uint32_t bits) noexcept {
+        assert(bits <= 32);
+        while (m_PendingBits < bits) {
+            if (m_Offset == m_Buffer.size()) {
+                return false;
+            }
+            m_Pending |= static_cast<uint64_t>(m_Buffer[m_Offset++]) << m_PendingBits;
+            m_PendingBits += 8;
+        }
+        out = static_cast<uint32_t>(m_Pending & ((uint64_t{1} << bits) - 1));
+        m_Pending >>= bits;
+        m_PendingBits -= bits;
+        return true;
+    }
+
+    bool get_bit(bool& out) noexcept {
+        uint32_t bit{0};
+        if (!get(bit, 1)) {
+            return false;
+        }
+        out = bit != 0;
+        return true;
+    }
+
+    bool get_gamma(uint32_t& out) noexcept {
+        uint32_t width{0};
+        bool bit{false};
+        while (get_bit(bit) && !bit) {
+            if (++width > 31) {
+                return false;
+            }
+        }
+
+        uint32_t low{0};
+        if (!bit || !get(low, width)) {
+            return false;
+        }
+        out = (1U << width) | low;
+        return true;
+    }
+};
+
+}  // namespace pill_game::net
@@ -0,0 +1,199 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/net/protocol.h"
+
+namespace pill_game::net {
+
+namespace {
+
+void put_piece(MessageWriter& out, const BoardPiece& piece) noexcept {
+    out.put(std::bit_cast<uint8_t>(piece.Left));
+    out.put(std::bit_cast<uint8_t>(piece.Right));
+    out.put(piece.Rotation);
+    out.put(piece.Row);
+    out.put(piece.Column);
+}
+
+bool get_piece(MessageReader& in, BoardPiece& piece) noexcept {
+    uint8_t left{0};
+    uint8_t right{0};
+    if (!in.get(left) || !in.get(right) || !in.get(piece.Rotation) || !in.get(piece.Row)
+        || !in.get(piece.Column)) {
+        return false;
+    }
+    piece.Left = std::bit_cast<BoardEntity>(left);
+    piece.Right = std::bit_cast<BoardEntity>(right);
+    return true;
+}
+
+bool same_piece(const BoardPiece& lhs, const BoardPiece& rhs) noexcept {
+    return std::bit_cast<uint8_t>(lhs.Left) == std::bit_cast<uint8_t>(rhs.Left)
+           && std::bit_cast<uint8_t>(lhs.Right) == std::bit_cast<uint8_t>(rhs.Right)
+           && lhs.Rotation == rhs.Rotation
+           && lhs.Row == rhs.Row
+           && lhs.Column == rhs.Column;
+}
+
+// Skips the type byte after checking it
+std::optional<MessageReader> open(std::span<const uint8_t> message, MessageType expected) noexcept {
+    if (message_type(message) != expected) {
+        return std::nullopt;
+    }
+    return MessageReader{message.subspan(1)};
+}
+
+}  // namespace
+
+std::optional<MessageType> message_type(std::span<const uint8_t> message) noexcept {
+    if (message.empty() || message.front() < static_cast<uint8_t>(MessageType::Hello)
+        || message.front() > static_cast<uint8_t>(MessageType::GameOver)) {
+        return std::nullopt;
+    }
+    return static_cast<MessageType>(message.front());
+}
+
+size_t encode_hello(MessageBuffer& buffer, const HelloMessage& hello) noexcept {
+    MessageWriter out{buffer};
+    out.put(MessageType::Hello);
+    out.put(hello.Seed);
+    out.put(hello.Level);
+    out.put(hello.Flags);
+    return out.size();
+}
+
+size_t encode_input(MessageBuffer& buffer, const InputMessage& input) noexcept {
+    MessageWriter out{buffer};
+    out.put(MessageType::Input);
+    out.put(static_cast<uint8_t>(input.Key));
+    out.put(static_cast<uint8_t>(input.Pressed ? 1 : 0));
+    return out.size();
+}
+
+size_t encode_welcome(MessageBuffer& buffer, uint32_t session_id) noexcept {
+    MessageWriter out{buffer};
+    out.put(MessageType::Welcome);
+    out.put(session_id);
+    return out.size();
+}
+
+size_t encode_reject(MessageBuffer& buffer) noexcept {
+    MessageWriter out{buffer};
+    out.put(MessageType::Reject);
+    return out.size();
+}
+
+size_t encode_game_over(MessageBuffer& buffer, const game::GameSession& session) noexcept {
+    MessageWriter out{buffer};
+    out.put(MessageType::GameOver);
+    out.put(session.Score);
+    out.put(static_cast<uint32_t>(session.Ticks));
+    out.put(static_cast<uint8_t>(session.is_won() ? 1 : 0));
+    return out.size();
+}
+
+size_t encode_board_delta(
+    MessageBuffer& buffer,
+    const game::GameSession& session,
+    BoardMirror& last_sent,
+    bool full
+) noexcept {
+    const auto& cells = session.Board.flat_game_board();
+
+    // the cell count goes in front of the cells; it's patched in once known
+    MessageWriter out{buffer};
+    out.put(MessageType::BoardDelta);
+    out.put(static_cast<uint32_t>(session.Ticks));
+    out.put(session.Score);
+    put_piece(out, session.Piece);
+    const size_t count_offset = out.size();
+    out.put(uint8_t{0});
+
+    uint32_t changed{0};
+    for (size_t i = 0; i < cells.size(); ++i) {
+        const auto cell = std::bit_cast<uint8_t>(cells.at(i));
+        if (full || cell != std::bit_cast<uint8_t>(last_sent.Cells.at(i))) {
+            out.put(static_cast<uint8_t>(i));
+            out.put(cell);
+            ++changed;
+        }
+    }
+
+    const bool piece_changed = !same_piece(session.Piece, last_sent.Piece);
+    const bool score_changed = session.Score != last_sent.Score;
+    if (changed == 0 && !piece_changed && !score_changed && !full) {
+        return 0;
+    }
+
+    buffer.at(count_offset) = static_cast<uint8_t>(changed);
+
+    last_sent.Cells = cells;
+    last_sent.Piece = session.Piece;
+    last_sent.Tick = static_cast<uint32_t>(session.Ticks);
+    last_sent.Score = session.Score;
+    return out.size();
+}
+
+std::optional<HelloMessage> decode_hello(std::span<const uint8_t> message) noexcept {
+    auto in = open(message, MessageType::Hello);
+    HelloMessage hello{};
+    if (!in || !in->get(hello.Seed) || !in->get(hello.Level) || !in->get(hello.Flags)) {
+        return std::nullopt;
+    }
+    return hello;
+}
+
+std::optional<InputMessage> decode_input(std::span<const uint8_t> message) noexcept {
+    auto in = open(message, MessageType::Input);
+    uint8_t key{0};
+    uint8_t pressed{0};
+    if (!in || !in->get(key) || !in->get(pressed) || key > static_cast<uint8_t>(game::Button::Pause)) {
+        return std::nullopt;
+    }
+    return InputMessage{static_cast<game::Button>(key), pressed != 0};
+}
+
+std::optional<uint32_t> decode_welcome(std::span<const uint8_t> message) noexcept {
+    auto in = open(message, MessageType::Welcome);
+    uint32_t session_id{0};
+    if (!in || !in->get(session_id)) {
+        return std::nullopt;
+    }
+    return session_id;
+}
+
+std::optional<GameOverMessage> decode_game_over(std::span<const uint8_t> message) noexcept {
+    auto in = open(message, MessageType::GameOver);
+    GameOverMessage game_over{};
+    uint8_t won{0};
+    if (!in || !in->get(game_over.Score) || !in->get(game_over.Ticks) || !in->get(won)) {
+        return std::nullopt;
+    }
+    game_over.Won = won != 0;
+    return game_over;
+}
+
+bool apply_board_delta(std::span<const uint8_t> message, BoardMirror& mirror) noexcept {
+    auto in = open(message, MessageType::BoardDelta);
+    uint8_t count{0};
+    if (!in || !in->get(mirror.Tick) || !in->get(mirror.Score) || !get_piece(*in, mirror.Piece)
+        || !in->get(count)) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < count; ++i) {
+        uint8_t index{0};
+        uint8_t cell{0};
+        if (!in->get(index) || !in->get(cell) || index >= mirror.Cells.size()) {
+            return false;
+        }
+        mirror.Cells.at(index) = std::bit_cast<BoardEntity>(cell);
+    }
+    return true;
+}
+
+}  // namespace pill_game::net
@@ -0,0 +1,147 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+#include "pill_game/game/game_session.h"
+
+namespace pill_game::net {
+
+//
+// Client <-> server messages. Every message is one datagram (or one
+// SOCK_SEQPACKET record): a MessageType byte followed by little endian fields,
+// no padding and no length prefix.
+//
+// Client -> server : Hello (start a game), Input (one button edge)
+// Server -> client : Welcome, Reject, BoardDelta (after every tick that
+//                    changed something), GameOver
+//
+
+enum class MessageType : uint8_t {
+    Hello = 1,
+    Input,
+    Welcome,
+    Reject,
+    BoardDelta,
+    GameOver,
+};
+
+// clang-format off
+constexpr size_t   BOARD_DELTA_HEADER_SIZE = 1 + 4 + 4 + 5 + 1;  // type, tick, score, piece, count
+constexpr size_t   MAX_MESSAGE_SIZE        = BOARD_DELTA_HEADER_SIZE + (GAME_BOARD_SIZE * 2);
+constexpr uint8_t  HELLO_FLAG_PILLS        = 1U << 0U;
+constexpr uint8_t  HELLO_FLAG_BLOCKS       = 1U << 1U;
+// clang-format on
+
+static_assert(GAME_BOARD_SIZE < 256, "cell indices and counts are sent as one byte");
+static_assert(std::endian::native == std::endian::little);
+
+using MessageBuffer = std::array<uint8_t, MAX_MESSAGE_SIZE>;
+using BoardCells = std::array<BoardEntity, GAME_BOARD_SIZE>;
+
+struct HelloMessage {
+    uint32_t Seed{0};
+    uint8_t Level{0};
+    uint8_t Flags{0};
+};
+
+struct InputMessage {
+    game::Button Key{game::Button::Up};
+    bool Pressed{false};
+};
+
+struct GameOverMessage {
+    uint32_t Score{0};
+    uint32_t Ticks{0};
+    bool Won{false};
+};
+
+// What a client knows about a session; kept in step by BoardDelta messages
+struct BoardMirror {
+    BoardCells Cells{};
+    BoardPiece Piece{};
+    uint32_t Tick{0};
+    uint32_t Score{0};
+};
+
+//
+// Appends fields to a message; the buffer always has room for the largest
+// message so nothing here can fail.
+//
+class MessageWriter {
+   private:
+    MessageBuffer& m_Buffer;
+    size_t m_Size{0};
+
+   public:
+    explicit MessageWriter(MessageBuffer& buffer) noexcept : m_Buffer(buffer) {}
+
+   public:
+    template <class T>
+    void put(T value) noexcept {
+        static_assert(std::is_trivially_copyable_v<T>);
+        assert(m_Size + sizeof(T) <= m_Buffer.size());
+        std::memcpy(m_Buffer.data() + m_Size, &value, sizeof(T));
+        m_Size += sizeof(T);
+    }
+
+    void put(MessageType type) noexcept { put(static_cast<uint8_t>(type)); }
+
+    std::span<const uint8_t> view() const noexcept { return {m_Buffer.data(), m_Size}; }
+    size_t size() const noexcept { return m_Size; }
+};
+
+// Reads fields back out; every get() fails once the message runs out
+class MessageReader {
+   private:
+    std::span<const uint8_t> m_Data;
+    size_t m_Offset{0};
+
+   public:
+    explicit MessageReader(std::span<const uint8_t> data) noexcept : m_Data(data) {}
+
+   public:
+    template <class T>
+    bool get(T& out) noexcept {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (m_Offset + sizeof(T) > m_Data.size()) {
+            return false;
+        }
+        std::memcpy(&out, m_Data.data() + m_Offset, sizeof(T));
+        m_Offset += sizeof(T);
+        return true;
+    }
+
+    size_t remaining() const noexcept { return m_Data.size() - m_Offset; }
+};
+
+std::optional<MessageType> message_type(std::span<const uint8_t> message) noexcept;
+
+size_t encode_hello(MessageBuffer& buffer, const HelloMessage& hello) noexcept;
+size_t encode_input(MessageBuffer& buffer, const InputMessage& input) noexcept;
+size_t encode_welcome(MessageBuffer& buffer, uint32_t session_id) noexcept;
+size_t encode_reject(MessageBuffer& buffer) noexcept;
+size_t encode_game_over(MessageBuffer& buffer, const game::GameSession& session) noexcept;
+
+// Cells that differ from 'last_sent' (all of them when 'full'), plus the
+// piece, tick and score; 'last_sent' is updated to match. Returns 0 when the
+// client already has an up to date view.
+size_t encode_board_delta(
+    MessageBuffer& buffer,
+    const game::GameSession& session,
+    BoardMirror& last_sent,
+    bool full
+) noexcept;
+
+std::optional<HelloMessage> decode_hello(std::span<const uint8_t> message) noexcept;
+std::optional<InputMessage> decode_input(std::span<const uint8_t> message) noexcept;
+std::optional<uint32_t> decode_welcome(std::span<const uint8_t> message) noexcept;
+std::optional<GameOverMessage> decode_game_over(std::span<const uint8_t> message) noexcept;
+bool apply_board_delta(std::span<const uint8_t> message, BoardMirror& mirror) noexcept;
+
+}  // namespace pill_game::net
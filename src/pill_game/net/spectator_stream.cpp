@@ -0,0 +1,285 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/net/spectator_stream.h"
+
+#include "pill_game/game/packed_board.h"
+#include "pill_game/net/bit_stream.h"
+
+namespace pill_game::net {
+
+namespace {
+
+// clang-format off
+constexpr uint32_t CELL_BITS   = PACKED_CELL_BITS;
+constexpr uint32_t TICK_BITS   = 32;
+constexpr uint32_t SCORE_BITS  = 32;
+constexpr uint32_t ROTATE_BITS = 2;
+constexpr int32_t  ROW_BIAS    = GAME_BOARD_HEIGHT;  // rows from -HEIGHT up to 2 * HEIGHT
+constexpr int32_t  COLUMN_BIAS = GAME_BOARD_WIDTH;
+constexpr uint32_t ROW_BITS    = std::bit_width(3 * GAME_BOARD_HEIGHT - 1);
+constexpr uint32_t COLUMN_BITS = std::bit_width(3 * GAME_BOARD_WIDTH - 1);
+// clang-format on
+
+enum class PieceChange : uint8_t {
+    None = 0,
+    Moved,     // position or rotation
+    Replaced,  // a new piece; colours as well
+};
+
+constexpr uint32_t PIECE_CHANGE_BITS = 2;
+
+uint32_t cell_bits(BoardEntity cell) noexcept {
+    return pack_cell(cell);
+}
+
+bool get_cell(BitReader& in, BoardEntity& cell) noexcept {
+    uint32_t code{0};
+    if (!in.get(code, CELL_BITS) || code >= PACKED_CELL_COUNT) {
+        return false;
+    }
+    cell = unpack_cell(static_cast<uint8_t>(code));
+    return true;
+}
+
+bool same_cell(BoardEntity lhs, BoardEntity rhs) noexcept {
+    return std::bit_cast<uint8_t>(lhs) == std::bit_cast<uint8_t>(rhs);
+}
+
+PieceChange piece_change(const BoardPiece& now, const BoardPiece& last) noexcept {
+    if (!same_cell(now.Left, last.Left) || !same_cell(now.Right, last.Right)) {
+        return PieceChange::Replaced;
+    }
+    if (now.Rotation != last.Rotation || now.Row != last.Row || now.Column != last.Column) {
+        return PieceChange::Moved;
+    }
+    return PieceChange::None;
+}
+
+void put_piece(BitWriter& out, const BoardPiece& piece, PieceChange change) noexcept {
+    out.put(static_cast<uint32_t>(change), PIECE_CHANGE_BITS);
+    if (change == PieceChange::None) {
+        return;
+    }
+    if (change == PieceChange::Replaced) {
+        out.put(cell_bits(piece.Left), CELL_BITS);
+        out.put(cell_bits(piece.Right), CELL_BITS);
+    }
+
+    assert(piece.Row + ROW_BIAS >= 0 && piece.Row + ROW_BIAS < (1 << ROW_BITS));
+    assert(piece.Column + COLUMN_BIAS >= 0 && piece.Column + COLUMN_BIAS < (1 << COLUMN_BITS));
+    out.put(piece.Rotation, ROTATE_BITS);
+    out.put(static_cast<uint32_t>(piece.Row + ROW_BIAS), ROW_BITS);
+    out.put(static_cast<uint32_t>(piece.Column + COLUMN_BIAS), COLUMN_BITS);
+}
+
+bool get_piece(BitReader& in, BoardPiece& piece) noexcept {
+    uint32_t change{0};
+    if (!in.get(change, PIECE_CHANGE_BITS) || change > static_cast<uint32_t>(PieceChange::Replaced)) {
+        return false;
+    }
+    if (change == static_cast<uint32_t>(PieceChange::None)) {
+        return true;
+    }
+    if (change == static_cast<uint32_t>(PieceChange::Replaced)
+        && (!get_cell(in, piece.Left) || !get_cell(in, piece.Right))) {
+        return false;
+    }
+
+    uint32_t rotation{0};
+    uint32_t row{0};
+    uint32_t column{0};
+    if (!in.get(rotation, ROTATE_BITS) || !in.get(row, ROW_BITS) || !in.get(column, COLUMN_BITS)) {
+        return false;
+    }
+    piece.Rotation = static_cast<uint8_t>(rotation);
+    piece.Row = static_cast<int8_t>(static_cast<int32_t>(row) - ROW_BIAS);
+    piece.Column = static_cast<int8_t>(static_cast<int32_t>(column) - COLUMN_BIAS);
+    return true;
+}
+
+// The whole board as (cell, run length) pairs; mostly long runs of empty cells
+void put_keyframe_cells(BitWriter& out, const BoardCells& cells) noexcept {
+    size_t i{0};
+    while (i < cells.size()) {
+        size_t end = i + 1;
+        while (end < cells.size() && same_cell(cells.at(end), cells.at(i))) {
+            ++end;
+        }
+        out.put(cell_bits(cells.at(i)), CELL_BITS);
+        out.put_gamma(static_cast<uint32_t>(end - i));
+        i = end;
+    }
+}
+
+bool get_keyframe_cells(BitReader& in, BoardCells& cells) noexcept {
+    size_t i{0};
+    while (i < cells.size()) {
+        BoardEntity cell{};
+        uint32_t length{0};
+        if (!get_cell(in, cell) || !in.get_gamma(length) || length > cells.size() - i) {
+            return false;
+        }
+        std::fill_n(cells.begin() + static_cast<ptrdiff_t>(i), length, cell);
+        i += length;
+    }
+    return true;
+}
+
+//
+// Alternating runs: how many cells to skip, then how many changed cells
+// follow (and their values). The skip that reaches the end of the board ends
+// the list, so no run count is needed up front.
+//
+void put_changed_cells(BitWriter& out, const BoardCells& cells, const BoardCells& last) noexcept {
+    size_t i{0};
+    while (true) {
+        size_t start = i;
+        while (start < cells.size() && same_cell(cells.at(start), last.at(start))) {
+            ++start;
+        }
+        out.put_gamma(static_cast<uint32_t>(start - i) + 1);
+        if (start == cells.size()) {
+            return;
+        }
+
+        size_t end = start + 1;
+        while (end < cells.size() && !same_cell(cells.at(end), last.at(end))) {
+            ++end;
+        }
+        out.put_gamma(static_cast<uint32_t>(end - start));
+        for (size_t c = start; c < end; ++c) {
+            out.put(cell_bits(cells.at(c)), CELL_BITS);
+        }
+        i = end;
+    }
+}
+
+bool get_changed_cells(BitReader& in, BoardCells& cells) noexcept {
+    size_t i{0};
+    while (true) {
+        uint32_t skip{0};
+        if (!in.get_gamma(skip) || skip - 1 > cells.size() - i) {
+            return false;
+        }
+        i += skip - 1;
+        if (i == cells.size()) {
+            return true;
+        }
+
+        uint32_t length{0};
+        if (!in.get_gamma(length) || length > cells.size() - i) {
+            return false;
+        }
+        for (uint32_t c = 0; c < length; ++c, ++i) {
+            if (!get_cell(in, cells.at(i))) {
+                return false;
+            }
+        }
+    }
+}
+
+}  // namespace
+
+SpectatorEncoder::SpectatorEncoder(uint32_t keyframe_ticks) noexcept
+    : m_KeyframeTicks(std::max(1U, keyframe_ticks)) {
+}
+
+size_t SpectatorEncoder::encode(const game::GameSession& session, SpectatorFrame& frame) noexcept {
+    const auto tick = static_cast<uint32_t>(session.Ticks);
+    const BoardCells& cells = session.Board.flat_game_board();
+
+    // a restarted session goes backwards in time and score; deltas can't describe that
+    const bool keyframe = m_NeedKeyframe
+                          || tick < m_Last.Tick
+                          || session.Score < m_Last.Score
+                          || tick - m_LastKeyframeTick >= m_KeyframeTicks;
+
+    BitWriter out{frame};
+    out.put_bit(keyframe);
+
+    if (keyframe) {
+        out.put(tick, TICK_BITS);
+        out.put(session.Score, SCORE_BITS);
+        put_piece(out, session.Piece, PieceChange::Replaced);
+        put_keyframe_cells(out, cells);
+
+        m_NeedKeyframe = false;
+        m_LastKeyframeTick = tick;
+
+    } else {
+        const PieceChange piece = piece_change(session.Piece, m_Last.Piece);
+        const bool score_changed = session.Score != m_Last.Score;
+        // BoardEntity's operator== ignores rotation, which spectators still draw
+        const bool cells_changed = std::memcmp(cells.data(), m_Last.Board.flat_game_board().data(), sizeof(cells)) != 0;
+        if (piece == PieceChange::None && !score_changed && !cells_changed) {
+            return 0;
+        }
+
+        out.put_gamma(tick - m_Last.Tick + 1);
+        out.put_bit(score_changed);
+        if (score_changed) {
+            out.put_gamma(session.Score - m_Last.Score);
+        }
+        put_piece(out, session.Piece, piece);
+        out.put_bit(cells_changed);
+        if (cells_changed) {
+            put_changed_cells(out, cells, m_Last.Board.flat_game_board());
+        }
+    }
+
+    m_Last.Board.flat_game_board() = cells;
+    m_Last.Piece = session.Piece;
+    m_Last.Tick = tick;
+    m_Last.Score = session.Score;
+    return out.finish();
+}
+
+SpectatorDecoder::SpectatorDecoder() noexcept = default;
+
+bool SpectatorDecoder::decode(std::span<const uint8_t> frame) noexcept {
+    BitReader in{frame};
+
+    bool keyframe{false};
+    if (!in.get_bit(keyframe) || (!keyframe && !m_Synced)) {
+        return false;
+    }
+
+    // decode into a copy so a malformed frame leaves the last good view alone
+    SpectatorView view = m_View;
+    bool ok{false};
+
+    if (keyframe) {
+        ok = in.get(view.Tick, TICK_BITS)
+             && in.get(view.Score, SCORE_BITS)
+             && get_piece(in, view.Piece)
+             && get_keyframe_cells(in, view.Board.flat_game_board());
+
+    } else {
+        uint32_t ticks{0};
+        bool score_changed{false};
+        uint32_t score{0};
+        bool cells_changed{false};
+
+        ok = in.get_gamma(ticks) && in.get_bit(score_changed);
+        ok = ok && (!score_changed || in.get_gamma(score));
+        ok = ok && get_piece(in, view.Piece) && in.get_bit(cells_changed);
+        ok = ok && (!cells_changed || get_changed_cells(in, view.Board.flat_game_board()));
+
+        view.Tick += ticks - 1;
+        view.Score += score;
+    }
+
+    m_Synced = ok;
+    if (ok) {
+        view.Board.recompute_stats();
+        m_View = view;
+    }
+    return ok;
+}
+
+}  // namespace pill_game::net
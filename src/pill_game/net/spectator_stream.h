@@ -0,0 +1,80 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+#include "pill_game/game/board.h"
+#include "pill_game/game/game_session.h"
+#include "pill_game/net/protocol.h"
+
+namespace pill_game::net {
+
+// clang-format off
+constexpr uint32_t SPECTATOR_KEYFRAME_TICKS = 2 * game::SIM_TICK_RATE;
+constexpr size_t   MAX_SPECTATOR_FRAME_SIZE = 256;  // a keyframe of 128 distinct runs is ~110 bytes
+// clang-format on
+
+using SpectatorFrame = std::array<uint8_t, MAX_SPECTATOR_FRAME_SIZE>;
+
+// What a spectator sees of a session
+struct SpectatorView {
+    PillGameBoard Board;
+    BoardPiece Piece{};
+    uint32_t Tick{0};
+    uint32_t Score{0};
+};
+
+//
+// Turns successive states of one session into a bit packed stream for
+// spectators. A keyframe carries the whole board as runs of identical cells;
+// every other frame carries only what changed since the previous frame:
+// runs of untouched cells are skipped with a variable length count, changed
+// cells are sent as 5 bit packed codes, and a moved piece only sends its
+// position. Keyframes go out every 'keyframe_ticks' so a spectator can join
+// (or recover from a lost frame) mid game.
+//
+class SpectatorEncoder {
+   private:
+    SpectatorView m_Last;
+    uint32_t m_KeyframeTicks{SPECTATOR_KEYFRAME_TICKS};
+    uint32_t m_LastKeyframeTick{0};
+    bool m_NeedKeyframe{true};
+
+   public:
+    explicit SpectatorEncoder(uint32_t keyframe_ticks = SPECTATOR_KEYFRAME_TICKS) noexcept;
+
+   public:
+    // Writes a frame for 'session'; returns its size, or 0 when nothing visible changed
+    size_t encode(const game::GameSession& session, SpectatorFrame& frame) noexcept;
+
+    // The next frame is a keyframe, e.g. because a spectator just joined
+    void request_keyframe() noexcept { m_NeedKeyframe = true; }
+};
+
+//
+// Rebuilds a SpectatorView from the frames of a SpectatorEncoder. Frames
+// before the first keyframe are ignored, as is everything after a malformed
+// frame until the next keyframe.
+//
+class SpectatorDecoder {
+   private:
+    SpectatorView m_View;
+    bool m_Synced{false};
+
+   public:
+    SpectatorDecoder() noexcept;
+
+   public:
+    // False if the frame couldn't be applied (not synced, or malformed)
+    bool decode(std::span<const uint8_t> frame) noexcept;
+
+    bool is_synced() const noexcept { return m_Synced; }
+    const SpectatorView& view() const noexcept { return m_View; }
+};
+
+}  // namespace pill_game::net
@@ -10,8 +10,10 @@
 #include <any>
 #include <array>
 #include <atomic>
+#include <cassert>
 #include <cctype>
 #include <charconv>
+#include <cmath>
 #include <chrono>
 #include <condition_variable>
 #include <cstdint>
@@ -31,6 +33,7 @@
 #include <queue>
 #include <ranges>
 #include <sstream>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -41,8 +44,11 @@
 #include <unordered_set>
 #include <utility>
 #include <variant>
+#include <vector>
+#include <bit>
 #include <bitset>
 
+#include "util/counter_rng.h"
 #include "util/logging.h"
 
 #include "pill_game/game/board_entity.h"
@@ -64,6 +70,18 @@ using std::uint16_t;
 using std::uint32_t;
 using std::uint8_t;
 
+// Engine behind board generation and piece bags. Everything random in a game
+// is drawn from its own stream of the session seed, so it doesn't matter what
+// else was drawn first or on which thread.
+using GameRng = CounterRng;
+
+// clang-format off
+constexpr uint32_t RNG_STREAM_BOARD  = 0;  // cell layout, one range per row
+constexpr uint32_t RNG_STREAM_COLOUR = 1;  // cell colours, one range per row
+constexpr uint32_t RNG_STREAM_BAG    = 2;  // piece bags, one range per bag
+constexpr uint64_t RNG_RANGE_SIZE    = 256;  // draws set aside for each row or bag
+// clang-format on
+
 constexpr size_t GAME_BOARD_WIDTH = 8;
 constexpr size_t GAME_BOARD_HEIGHT = 16;
 constexpr size_t GAME_BOARD_SIZE = GAME_BOARD_WIDTH * GAME_BOARD_HEIGHT;
@@ -74,6 +92,14 @@ static_assert(GAME_BOARD_HEIGHT >= 8 && GAME_BOARD_HEIGHT < std::numeric_limits<
 constexpr size_t GAME_BOARD_TOP_ROW = GAME_BOARD_HEIGHT - 1;
 constexpr size_t GAME_BOARD_CENTRE = (GAME_BOARD_WIDTH - 1) / 2;
 
+// Board sizes of the other modes; see BasicPillGameBoard
+// clang-format off
+constexpr size_t SPRINT_BOARD_WIDTH    = 6;
+constexpr size_t SPRINT_BOARD_HEIGHT   = 12;
+constexpr size_t MARATHON_BOARD_WIDTH  = 10;
+constexpr size_t MARATHON_BOARD_HEIGHT = 20;
+// clang-format on
+
 // clang-format off
 constexpr uint32_t COLOUR_RED    = 0x970054FF;
 constexpr uint32_t COLOUR_CYAN   = 0x3078E7FF;
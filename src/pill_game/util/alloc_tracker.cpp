@@ -0,0 +1,169 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "alloc_tracker.h"
+
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+namespace pill_game::memory {
+
+namespace {
+
+constexpr std::array<const char*, PhaseCount> phase_names{
+    "other",
+    "audio",
+    "events",
+    "sim",
+    "render",
+    "present",
+};
+
+}  // namespace
+
+const char* phase_name(AllocPhase phase) noexcept {
+    return phase < PhaseCount ? phase_names.at(phase) : "?";
+}
+
+#if PG_TRACK_ALLOCATIONS
+
+namespace {
+
+struct PhaseCounters {
+    std::atomic<uint64_t> Allocations{0};
+    std::atomic<uint64_t> Frees{0};
+    std::atomic<uint64_t> Bytes{0};
+};
+
+std::array<PhaseCounters, PhaseCount> counters{};
+thread_local AllocPhase current_phase{Other};
+
+void* tracked_alloc(size_t size) noexcept {
+    auto& phase = counters.at(current_phase);
+    phase.Allocations.fetch_add(1, std::memory_order_relaxed);
+    phase.Bytes.fetch_add(size, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void tracked_free(void* ptr) noexcept {
+    if (ptr == nullptr) {
+        return;
+    }
+    counters.at(current_phase).Frees.fetch_add(1, std::memory_order_relaxed);
+    std::free(ptr);
+}
+
+// Over-aligned blocks need their own free on Windows, so they get their own pair
+void* tracked_aligned_alloc(size_t size, std::align_val_t align) noexcept {
+    auto& phase = counters.at(current_phase);
+    phase.Allocations.fetch_add(1, std::memory_order_relaxed);
+    phase.Bytes.fetch_add(size, std::memory_order_relaxed);
+
+    const auto alignment = static_cast<size_t>(align);
+    const size_t rounded = size == 0 ? alignment : ((size + alignment - 1) / alignment) * alignment;
+#if defined(_WIN32)
+    return ::_aligned_malloc(rounded, alignment);
+#else
+    return std::aligned_alloc(alignment, rounded);
+#endif
+}
+
+void tracked_aligned_free(void* ptr) noexcept {
+    if (ptr == nullptr) {
+        return;
+    }
+    counters.at(current_phase).Frees.fetch_add(1, std::memory_order_relaxed);
+#if defined(_WIN32)
+    ::_aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+}  // namespace
+
+void set_phase(AllocPhase phase) noexcept {
+    current_phase = phase;
+}
+
+FrameAllocStats end_frame() noexcept {
+    FrameAllocStats stats{};
+    for (size_t i = 0; i < counters.size(); ++i) {
+        auto& phase = counters.at(i);
+        stats.Phases.at(i) = AllocStats{
+            phase.Allocations.exchange(0, std::memory_order_relaxed),
+            phase.Frees.exchange(0, std::memory_order_relaxed),
+            phase.Bytes.exchange(0, std::memory_order_relaxed),
+        };
+    }
+    return stats;
+}
+
+#endif
+
+}  // namespace pill_game::memory
+
+#if PG_TRACK_ALLOCATIONS
+
+//
+// The scalar forms, plain, nothrow and over-aligned; the default array
+// versions forward to these.
+//
+
+void* operator new(size_t size) {
+    void* ptr = pill_game::memory::tracked_alloc(size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc{};
+    }
+    return ptr;
+}
+
+void* operator new(size_t size, const std::nothrow_t& /*tag*/) noexcept {
+    return pill_game::memory::tracked_alloc(size);
+}
+
+void* operator new(size_t size, std::align_val_t align) {
+    void* ptr = pill_game::memory::tracked_aligned_alloc(size, align);
+    if (ptr == nullptr) {
+        throw std::bad_alloc{};
+    }
+    return ptr;
+}
+
+void* operator new(size_t size, std::align_val_t align, const std::nothrow_t& /*tag*/) noexcept {
+    return pill_game::memory::tracked_aligned_alloc(size, align);
+}
+
+void operator delete(void* ptr) noexcept {
+    pill_game::memory::tracked_free(ptr);
+}
+
+void operator delete(void* ptr, size_t /*size*/) noexcept {
+    pill_game::memory::tracked_free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t& /*tag*/) noexcept {
+    pill_game::memory::tracked_free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t /*align*/) noexcept {
+    pill_game::memory::tracked_aligned_free(ptr);
+}
+
+void operator delete(void* ptr, size_t /*size*/, std::align_val_t /*align*/) noexcept {
+    pill_game::memory::tracked_aligned_free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t /*align*/, const std::nothrow_t& /*tag*/) noexcept {
+    pill_game::memory::tracked_aligned_free(ptr);
+}
+
+#endif
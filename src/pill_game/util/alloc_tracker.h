@@ -0,0 +1,79 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+//
+// Build with -DPILL_GAME_TRACK_ALLOCATIONS=ON to hook the global operator
+// new/delete and count heap traffic per frame and per phase of the frame.
+//
+#ifndef PG_TRACK_ALLOCATIONS
+#define PG_TRACK_ALLOCATIONS 0
+#endif
+
+namespace pill_game::memory {
+
+using std::uint64_t;
+using std::uint8_t;
+
+constexpr bool ALLOC_TRACKING_ENABLED = PG_TRACK_ALLOCATIONS != 0;
+
+// Frames in a scene that may allocate (first tick setup, caches warming up)
+// before the steady-state check kicks in.
+constexpr uint64_t ALLOC_WARMUP_FRAMES = 120;
+
+// NOLINTNEXTLINE
+enum AllocPhase : uint8_t {
+    Other = 0,
+    Audio,
+    Events,
+    Simulation,
+    Render,
+    Present,
+    PhaseCount
+};
+
+struct AllocStats {
+    uint64_t Allocations{0};
+    uint64_t Frees{0};
+    uint64_t Bytes{0};
+};
+
+struct FrameAllocStats {
+    std::array<AllocStats, PhaseCount> Phases{};
+
+    AllocStats total() const noexcept {
+        AllocStats sum{};
+        for (const AllocStats& phase : Phases) {
+            sum.Allocations += phase.Allocations;
+            sum.Frees += phase.Frees;
+            sum.Bytes += phase.Bytes;
+        }
+        return sum;
+    }
+};
+
+#if PG_TRACK_ALLOCATIONS
+
+// Attributes allocations made by the calling thread to 'phase'
+void set_phase(AllocPhase phase) noexcept;
+
+// Returns everything counted since the previous call and resets the counters
+FrameAllocStats end_frame() noexcept;
+
+#else
+
+inline void set_phase(AllocPhase /*phase*/) noexcept {}
+inline FrameAllocStats end_frame() noexcept { return {}; }
+
+#endif
+
+const char* phase_name(AllocPhase phase) noexcept;
+
+}  // namespace pill_game::memory
@@ -0,0 +1,91 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "arena.h"
+
+namespace pill_game::memory {
+
+BumpArena::BumpArena(size_t capacity, std::pmr::memory_resource* upstream)
+    : m_Buffer(std::make_unique<std::byte[]>(capacity)),
+      m_Capacity(capacity),
+      m_Upstream(upstream) {
+}
+
+void* BumpArena::do_allocate(size_t bytes, size_t alignment) {
+    const auto base = reinterpret_cast<uintptr_t>(m_Buffer.get());
+    const uintptr_t aligned = (base + m_Offset + (alignment - 1)) & ~(static_cast<uintptr_t>(alignment) - 1);
+    const size_t end = (aligned - base) + bytes;
+
+    if (end > m_Capacity) {
+        return m_Upstream->allocate(bytes, alignment);
+    }
+
+    m_Offset = end;
+    m_HighWater = std::max(m_HighWater, m_Offset);
+    return reinterpret_cast<void*>(aligned);
+}
+
+void BumpArena::do_deallocate(void* ptr, size_t bytes, size_t alignment) noexcept {
+    const auto* begin = m_Buffer.get();
+    const auto* bptr = static_cast<const std::byte*>(ptr);
+
+    // memory from the arena is released by reset()
+    if (bptr >= begin && bptr < begin + m_Capacity) {
+        return;
+    }
+    m_Upstream->deallocate(ptr, bytes, alignment);
+}
+
+BlockPool::BlockPool(size_t block_size, size_t block_count, std::pmr::memory_resource* upstream)
+    : m_Buffer(std::make_unique<std::byte[]>(block_size * block_count)),
+      m_BlockSize(block_size),
+      m_BlockCount(block_count),
+      m_Upstream(upstream) {
+    assert(block_size >= sizeof(void*) && block_size % alignof(std::max_align_t) == 0);
+
+    // thread every block onto the free list, lowest address first
+    for (size_t i = block_count; i > 0; --i) {
+        void* block = m_Buffer.get() + ((i - 1) * block_size);
+        *static_cast<void**>(block) = m_FreeList;
+        m_FreeList = block;
+    }
+}
+
+bool BlockPool::owns(const void* ptr) const noexcept {
+    const auto* begin = m_Buffer.get();
+    const auto* bptr = static_cast<const std::byte*>(ptr);
+    return bptr >= begin && bptr < begin + (m_BlockSize * m_BlockCount);
+}
+
+void* BlockPool::do_allocate(size_t bytes, size_t alignment) {
+    if (bytes > m_BlockSize || alignment > alignof(std::max_align_t) || m_FreeList == nullptr) {
+        return m_Upstream->allocate(bytes, alignment);
+    }
+
+    void* block = m_FreeList;
+    m_FreeList = *static_cast<void**>(block);
+    ++m_InUse;
+    return block;
+}
+
+void BlockPool::do_deallocate(void* ptr, size_t bytes, size_t alignment) noexcept {
+    if (!owns(ptr)) {
+        m_Upstream->deallocate(ptr, bytes, alignment);
+        return;
+    }
+
+    *static_cast<void**>(ptr) = m_FreeList;
+    m_FreeList = ptr;
+    --m_InUse;
+}
+
+BlockPool& coroutine_pool() noexcept {
+    thread_local BlockPool pool{COROUTINE_BLOCK_SIZE, COROUTINE_BLOCK_COUNT};
+    return pool;
+}
+
+}  // namespace pill_game::memory
\ No newline at end of file
@@ -0,0 +1,110 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace pill_game::memory {
+
+// clang-format off
+constexpr size_t FRAME_ARENA_SIZE      = 256 * 1024;
+constexpr size_t COROUTINE_BLOCK_SIZE  = 512;
+constexpr size_t COROUTINE_BLOCK_COUNT = 64;
+// clang-format on
+
+//
+// Linear allocator for data that only lives for one frame. Deallocation is
+// a no-op; everything is released at once by reset(). Requests that don't
+// fit go to the upstream resource so an undersized arena is slower rather
+// than broken; the allocation tracker will flag it.
+//
+class BumpArena final : public std::pmr::memory_resource {
+   private:
+    std::unique_ptr<std::byte[]> m_Buffer;
+    size_t m_Capacity{0};
+    size_t m_Offset{0};
+    size_t m_HighWater{0};
+    std::pmr::memory_resource* m_Upstream{nullptr};
+
+   public:
+    explicit BumpArena(
+        size_t capacity,
+        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()
+    );
+    ~BumpArena() noexcept override = default;
+
+   public:
+    BumpArena(const BumpArena&) = delete;
+    BumpArena& operator=(const BumpArena&) = delete;
+    BumpArena(BumpArena&&) noexcept = default;
+    BumpArena& operator=(BumpArena&&) noexcept = default;
+
+   public:
+    void reset() noexcept { m_Offset = 0; }
+
+    size_t used() const noexcept { return m_Offset; }
+    size_t capacity() const noexcept { return m_Capacity; }
+    size_t high_water() const noexcept { return m_HighWater; }
+
+    template <class T>
+    std::pmr::polymorphic_allocator<T> allocator() noexcept {
+        return std::pmr::polymorphic_allocator<T>{this};
+    }
+
+   private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) noexcept override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+//
+// Fixed size blocks recycled through a free list, for objects that outlive a
+// frame but come and go often (coroutine frames). Requests larger than a
+// block, or made while the pool is exhausted, go to the upstream resource.
+//
+class BlockPool final : public std::pmr::memory_resource {
+   private:
+    std::unique_ptr<std::byte[]> m_Buffer;
+    size_t m_BlockSize{0};
+    size_t m_BlockCount{0};
+    void* m_FreeList{nullptr};  // each free block stores the next one
+    size_t m_InUse{0};
+    std::pmr::memory_resource* m_Upstream{nullptr};
+
+   public:
+    BlockPool(
+        size_t block_size,
+        size_t block_count,
+        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()
+    );
+    ~BlockPool() noexcept override = default;
+
+   public:
+    BlockPool(const BlockPool&) = delete;
+    BlockPool& operator=(const BlockPool&) = delete;
+
+   public:
+    size_t block_size() const noexcept { return m_BlockSize; }
+    size_t in_use() const noexcept { return m_InUse; }
+
+   private:
+    bool owns(const void* ptr) const noexcept;
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) noexcept override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// Pool owned by the calling thread, for coroutine frames
+BlockPool& coroutine_pool() noexcept;
+
+}  // namespace pill_game::memory
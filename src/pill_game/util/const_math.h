@@ -0,0 +1,94 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace pill_game::const_math {
+
+//
+// Small constexpr replacements for the <cmath> functions the game's tables
+// are built from. They only use basic IEEE arithmetic, so a table built with
+// them comes out the same on every compiler and platform, where the library
+// versions of powf and friends may differ in the last bit between vendors.
+//
+// Accurate to about one double ulp over the ranges the tables use; not a
+// general purpose math library (no NaN, infinity or denormal handling).
+//
+
+constexpr double LN2 = 0.69314718055994530942;
+
+constexpr float floor(float x) noexcept {
+    const auto truncated = static_cast<float>(static_cast<int64_t>(x));
+    return truncated > x ? truncated - 1.0F : truncated;
+}
+
+// Halfway cases away from zero, as std::round
+constexpr float round(float x) noexcept {
+    return x < 0.0F ? -floor(0.5F - x) : floor(x + 0.5F);
+}
+
+// As std::lerp for 0 <= t <= 1 and a <= b: exact at both ends and never past b
+constexpr float lerp(float a, float b, float t) noexcept {
+    const float x = a + (t * (b - a));
+    return x < b ? x : b;
+}
+
+constexpr double exp(double x) noexcept {
+    // e^x = 2^k * e^r with |r| <= ln2 / 2, then a Taylor series for e^r
+    const auto k = static_cast<int64_t>(x / LN2 + (x < 0.0 ? -0.5 : 0.5));
+    const double r = x - (static_cast<double>(k) * LN2);
+
+    double term = 1.0;
+    double sum = 1.0;
+    for (int32_t n = 1; n < 24; ++n) {
+        term *= r / n;
+        sum += term;
+    }
+
+    for (int64_t i = 0; i < k; ++i) {
+        sum *= 2.0;
+    }
+    for (int64_t i = 0; i > k; --i) {
+        sum *= 0.5;
+    }
+    return sum;
+}
+
+// x > 0
+constexpr double log(double x) noexcept {
+    // x = m * 2^e with m in [sqrt(1/2), sqrt(2)), then log(m) = 2 atanh((m - 1) / (m + 1))
+    int32_t e = 0;
+    while (x >= 1.4142135623730951) {
+        x *= 0.5;
+        ++e;
+    }
+    while (x < 0.7071067811865476) {
+        x *= 2.0;
+        --e;
+    }
+
+    const double s = (x - 1.0) / (x + 1.0);
+    const double s2 = s * s;
+    double power = s;
+    double sum = 0.0;
+    for (int32_t n = 1; n < 60; n += 2) {
+        sum += power / n;
+        power *= s2;
+    }
+    return (2.0 * sum) + (static_cast<double>(e) * LN2);
+}
+
+// base >= 0; rounded once to float like powf
+constexpr float pow(float base, float exponent) noexcept {
+    if (base == 0.0F) {
+        return exponent == 0.0F ? 1.0F : 0.0F;
+    }
+    return static_cast<float>(exp(static_cast<double>(exponent) * log(static_cast<double>(base))));
+}
+
+}  // namespace pill_game::const_math
@@ -0,0 +1,92 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace pill_game {
+
+//
+// Counter based generator: the n'th value of a stream is a pure function of
+// (seed, stream, n), a SplitMix64 finaliser over the key and counter. There
+// is no state to warm up or share, so a stream costs nothing to create, any
+// point in it can be jumped to, and different streams (or different counter
+// ranges of one stream) can be drawn from on different threads with the same
+// results.
+//
+// Satisfies UniformRandomBitGenerator, so it drops into the standard
+// distributions and algorithms; their results differ between standard
+// libraries though, so anything a game depends on draws through below().
+//
+class CounterRng {
+   public:
+    using result_type = uint64_t;
+
+   private:
+    static constexpr uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ULL;
+
+    uint64_t m_Key{0};
+    uint64_t m_Counter{0};
+
+   public:
+    constexpr CounterRng() noexcept = default;
+    constexpr explicit CounterRng(uint32_t seed, uint32_t stream = 0, uint64_t counter = 0) noexcept
+        : m_Key(mix((static_cast<uint64_t>(stream) << 32U) | seed)),
+          m_Counter(counter) {}
+
+   public:
+    static constexpr result_type min() noexcept { return 0; }
+    static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+    constexpr result_type operator()() noexcept { return at(m_Counter++); }
+
+    // The value at 'counter' without moving the stream
+    constexpr result_type at(uint64_t counter) const noexcept {
+        return mix(m_Key + ((counter + 1) * GOLDEN_GAMMA));
+    }
+
+    // [0, bound) from the top 32 bits of one draw; biased by at most
+    // bound / 2^32, which is nothing for the handful of choices in a game
+    constexpr uint32_t below(uint32_t bound) noexcept {
+        return static_cast<uint32_t>(((*this)() >> 32U) * bound >> 32U);
+    }
+
+    constexpr uint64_t counter() const noexcept { return m_Counter; }
+    constexpr void seek(uint64_t counter) noexcept { m_Counter = counter; }
+
+   private:
+    static constexpr uint64_t mix(uint64_t x) noexcept {
+        x = (x ^ (x >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27U)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31U);
+    }
+};
+
+//
+// Several small bounded draws out of one generator value. Each below() takes
+// the next digit of the value read as a fraction in a mixed radix, so eight
+// picks from a handful of choices cost one draw rather than eight. Every pick
+// uses up log2(bound) of the 32 bits, so keep the product of the bounds well
+// under 2^32 or the later picks lose their spread.
+//
+class DrawSplitter {
+   private:
+    uint32_t m_Fraction{0};
+
+   public:
+    constexpr explicit DrawSplitter(uint64_t bits) noexcept : m_Fraction(static_cast<uint32_t>(bits >> 32U)) {}
+
+   public:
+    constexpr uint32_t below(uint32_t bound) noexcept {
+        const uint64_t product = static_cast<uint64_t>(m_Fraction) * bound;
+        m_Fraction = static_cast<uint32_t>(product);
+        return static_cast<uint32_t>(product >> 32U);
+    }
+};
+
+}  // namespace pill_game
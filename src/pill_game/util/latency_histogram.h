@@ -0,0 +1,94 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+
+namespace pill_game {
+
+//
+// Fixed size log-linear histogram of nanosecond durations: every power of two
+// is split into SUB_BUCKETS linear steps, so any recorded value is reported
+// within ~6% of what it was. Recording never allocates, and histograms from
+// different threads can be merged afterwards.
+//
+class LatencyHistogram {
+   private:
+    static constexpr uint32_t SUB_BUCKET_BITS = 4;
+    static constexpr uint32_t SUB_BUCKETS = 1U << SUB_BUCKET_BITS;
+    static constexpr uint32_t BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;  // exact below SUB_BUCKETS
+
+    std::array<uint64_t, BUCKET_COUNT> m_Counts{};
+    uint64_t m_Total{0};
+    uint64_t m_Max{0};
+    uint64_t m_Sum{0};
+
+   public:
+    void record(uint64_t value_ns) noexcept {
+        ++m_Counts.at(bucket_of(value_ns));
+        ++m_Total;
+        m_Sum += value_ns;
+        m_Max = std::max(m_Max, value_ns);
+    }
+
+    void merge(const LatencyHistogram& other) noexcept {
+        for (size_t i = 0; i < m_Counts.size(); ++i) {
+            m_Counts.at(i) += other.m_Counts.at(i);
+        }
+        m_Total += other.m_Total;
+        m_Sum += other.m_Sum;
+        m_Max = std::max(m_Max, other.m_Max);
+    }
+
+    void clear() noexcept { *this = LatencyHistogram{}; }
+
+    uint64_t count() const noexcept { return m_Total; }
+    uint64_t max() const noexcept { return m_Max; }
+    uint64_t mean() const noexcept { return m_Total == 0 ? 0 : m_Sum / m_Total; }
+
+    // Upper bound of the bucket holding the given percentile (0..100)
+    uint64_t percentile(double percent) const noexcept {
+        if (m_Total == 0) {
+            return 0;
+        }
+
+        const auto target = static_cast<uint64_t>(std::clamp(percent, 0.0, 100.0) / 100.0 * static_cast<double>(m_Total));
+        uint64_t seen{0};
+        for (uint32_t i = 0; i < BUCKET_COUNT; ++i) {
+            seen += m_Counts.at(i);
+            if (seen > target || seen == m_Total) {
+                return std::min(bucket_upper_bound(i), m_Max);
+            }
+        }
+        return m_Max;
+    }
+
+   private:
+    static uint32_t bucket_of(uint64_t value) noexcept {
+        if (value < SUB_BUCKETS) {
+            return static_cast<uint32_t>(value);
+        }
+        // keep the leading bit and the SUB_BUCKET_BITS below it
+        const auto exponent = static_cast<uint32_t>(std::bit_width(value)) - SUB_BUCKET_BITS - 1;
+        const auto sub = static_cast<uint32_t>(value >> exponent) - SUB_BUCKETS;
+        return SUB_BUCKETS + (exponent * SUB_BUCKETS) + sub;
+    }
+
+    static uint64_t bucket_upper_bound(uint32_t bucket) noexcept {
+        if (bucket < SUB_BUCKETS) {
+            return bucket;
+        }
+        const uint32_t exponent = (bucket - SUB_BUCKETS) / SUB_BUCKETS;
+        const uint64_t sub = (bucket - SUB_BUCKETS) % SUB_BUCKETS;
+        return (((SUB_BUCKETS + sub + 1) << exponent) - 1);
+    }
+};
+
+}  // namespace pill_game
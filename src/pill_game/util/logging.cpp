@@ -7,6 +7,8 @@
 #include "pill_game/pch.h"
 #include "logging.h"
 
+#include <iomanip>
+
 namespace pill_game::logging {
 
 namespace {
@@ -27,14 +29,9 @@ std::string_view truncate_left(std::string_view str, size_t len) {
 
 }  // namespace
 
-void log(LogLevel level, const std::source_location& /*loc*/, const std::string& message) noexcept {
-    std::string msg = std::format(
-        "[{:>5}] | {}\n",
-        // NOLINTNEXTLINE
-        log_levels[static_cast<size_t>(level)],
-        message
-    );
-    std::cout << msg;
+void log(LogLevel level, const std::source_location& /*loc*/, std::string_view message) noexcept {
+    // NOLINTNEXTLINE
+    std::cout << '[' << std::setw(5) << log_levels[static_cast<size_t>(level)] << "] | " << message << '\n';
 }
 
 }  // namespace pill_game::logging
\ No newline at end of file
@@ -6,7 +6,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <format>
 #include <string>
+#include <string_view>
 #include <cstdint>
 #include <source_location>
 
@@ -22,13 +26,35 @@ enum LogLevel : uint8_t {
     Err,
 };
 
-void log(LogLevel level, const std::source_location& loc, const std::string& message) noexcept;
+// Messages longer than this are truncated
+constexpr size_t LOG_BUFFER_SIZE = 512;
+
+void log(LogLevel level, const std::source_location& loc, std::string_view message) noexcept;
+
+// Formats into a stack buffer so that logging never touches the heap
+template <class... Args>
+void log_format(
+    LogLevel level,
+    const std::source_location& loc,
+    std::format_string<Args...> fmt,
+    Args&&... args
+) noexcept {
+    std::array<char, LOG_BUFFER_SIZE> buffer;  // NOLINT
+    const auto result = std::format_to_n(
+        buffer.data(),
+        static_cast<std::ptrdiff_t>(buffer.size()),
+        fmt,
+        std::forward<Args>(args)...
+    );
+    const auto length = std::min(static_cast<size_t>(result.size), buffer.size());
+    log(level, loc, std::string_view{buffer.data(), length});
+}
 
 #define PG_LOG(level, ...) (             \
-    ::pill_game::logging::log(           \
+    ::pill_game::logging::log_format(    \
         level,                           \
         std::source_location::current(), \
-        std::format(__VA_ARGS__)         \
+        __VA_ARGS__                      \
     )                                    \
 )
 
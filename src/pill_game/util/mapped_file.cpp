@@ -0,0 +1,148 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game/util/mapped_file.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace pill_game {
+
+#if defined(_WIN32)
+
+MappedFile::MappedFile(const fs::path& path) {
+    m_File = CreateFileW(
+        path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ | FILE_SHARE_WRITE,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS,
+        nullptr
+    );
+    if (m_File == INVALID_HANDLE_VALUE) {
+        m_File = nullptr;
+        throw std::runtime_error{std::format("Failed to open {} - error {}", path.string(), GetLastError())};
+    }
+
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(m_File, &size)) {
+        close();
+        throw std::runtime_error{std::format("Failed to size {} - error {}", path.string(), GetLastError())};
+    }
+    if (size.QuadPart == 0) {
+        return;
+    }
+
+    m_Mapping = CreateFileMappingW(m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* view = m_Mapping != nullptr ? MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (view == nullptr) {
+        const auto error = GetLastError();
+        close();
+        throw std::runtime_error{std::format("Failed to map {} - error {}", path.string(), error)};
+    }
+
+    m_Data = static_cast<const uint8_t*>(view);
+    m_Size = static_cast<size_t>(size.QuadPart);
+}
+
+void MappedFile::close() noexcept {
+    if (m_Data != nullptr) {
+        UnmapViewOfFile(m_Data);
+    }
+    if (m_Mapping != nullptr) {
+        CloseHandle(m_Mapping);
+    }
+    if (m_File != nullptr) {
+        CloseHandle(m_File);
+    }
+    m_Data = nullptr;
+    m_Size = 0;
+    m_Mapping = nullptr;
+    m_File = nullptr;
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_Data(std::exchange(other.m_Data, nullptr)),
+      m_Size(std::exchange(other.m_Size, 0)),
+      m_File(std::exchange(other.m_File, nullptr)),
+      m_Mapping(std::exchange(other.m_Mapping, nullptr)) {
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        m_Data = std::exchange(other.m_Data, nullptr);
+        m_Size = std::exchange(other.m_Size, 0);
+        m_File = std::exchange(other.m_File, nullptr);
+        m_Mapping = std::exchange(other.m_Mapping, nullptr);
+    }
+    return *this;
+}
+
+#else
+
+MappedFile::MappedFile(const fs::path& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::runtime_error{std::format("Failed to open {} - {}", path.string(), std::strerror(errno))};
+    }
+
+    struct stat info{};
+    if (::fstat(fd, &info) != 0) {
+        const int error = errno;
+        ::close(fd);
+        throw std::runtime_error{std::format("Failed to size {} - {}", path.string(), std::strerror(error))};
+    }
+
+    // the mapping keeps its own reference to the file
+    if (info.st_size > 0) {
+        void* view = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        if (view == MAP_FAILED) {
+            const int error = errno;
+            ::close(fd);
+            throw std::runtime_error{std::format("Failed to map {} - {}", path.string(), std::strerror(error))};
+        }
+        m_Data = static_cast<const uint8_t*>(view);
+        m_Size = static_cast<size_t>(info.st_size);
+    }
+    ::close(fd);
+}
+
+void MappedFile::close() noexcept {
+    if (m_Data != nullptr) {
+        ::munmap(const_cast<uint8_t*>(m_Data), m_Size);
+    }
+    m_Data = nullptr;
+    m_Size = 0;
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_Data(std::exchange(other.m_Data, nullptr)),
+      m_Size(std::exchange(other.m_Size, 0)) {
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        m_Data = std::exchange(other.m_Data, nullptr);
+        m_Size = std::exchange(other.m_Size, 0);
+    }
+    return *this;
+}
+
+#endif
+
+}  // namespace pill_game
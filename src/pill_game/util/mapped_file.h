@@ -0,0 +1,49 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace pill_game {
+
+//
+// Read only view of a whole file mapped into memory. Pages are loaded by the
+// OS on first touch, so opening a large file is cheap and only what is read
+// costs anything. An empty file maps to an empty span.
+//
+class MappedFile {
+   private:
+    const uint8_t* m_Data{nullptr};
+    size_t m_Size{0};
+#if defined(_WIN32)
+    void* m_File{nullptr};
+    void* m_Mapping{nullptr};
+#endif
+
+   public:
+    MappedFile() = default;
+    explicit MappedFile(const std::filesystem::path& path);  // throws std::runtime_error
+    ~MappedFile() noexcept { close(); }
+
+   public:
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+   public:
+    void close() noexcept;
+
+    bool empty() const noexcept { return m_Size == 0; }
+    std::span<const uint8_t> bytes() const noexcept { return {m_Data, m_Size}; }
+    size_t size() const noexcept { return m_Size; }
+};
+
+}  // namespace pill_game
@@ -0,0 +1,72 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace pill_game {
+
+//
+// Bounded lock-free queue for exactly one producer thread and one consumer
+// thread. Capacity must be a power of two; pushing onto a full queue fails.
+//
+template <class T, size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0);
+
+   private:
+    static constexpr size_t MASK = Capacity - 1;
+
+    std::array<T, Capacity> m_Items{};
+    alignas(64) std::atomic<size_t> m_Head{0};  // next to pop, written by the consumer
+    alignas(64) std::atomic<size_t> m_Tail{0};  // next to push, written by the producer
+
+   public:
+    SpscQueue() = default;
+
+   public:
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+   public:
+    bool try_push(const T& item) noexcept {
+        const size_t tail = m_Tail.load(std::memory_order_relaxed);
+        if (tail - m_Head.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        m_Items.at(tail & MASK) = item;
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Oldest item, or null when empty; valid until pop()
+    const T* peek() const noexcept {
+        const size_t head = m_Head.load(std::memory_order_relaxed);
+        if (head == m_Tail.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return &m_Items.at(head & MASK);
+    }
+
+    void pop() noexcept {
+        m_Head.store(m_Head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    bool try_pop(T& out) noexcept {
+        const T* item = peek();
+        if (item == nullptr) {
+            return false;
+        }
+        out = *item;
+        pop();
+        return true;
+    }
+};
+
+}  // namespace pill_game
@@ -0,0 +1,78 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <utility>
+
+#include "pill_game/util/arena.h"
+
+namespace pill_game {
+
+//
+// Fire and forget coroutine that starts running as soon as it is called and
+// is resumed by whatever it awaits. The Task owns the coroutine frame and
+// destroys it when it goes out of scope, suspended or not. Frames come from
+// the calling thread's coroutine_pool(), so a running script doesn't touch
+// the heap.
+//
+class Task {
+   public:
+    struct promise_type {
+        Task get_return_object() noexcept {
+            return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+
+        // surfaces in whoever resumed the task (the scene scheduler)
+        void unhandled_exception() const { throw; }
+
+        static void* operator new(size_t bytes) { return memory::coroutine_pool().allocate(bytes); }
+        static void operator delete(void* ptr, size_t bytes) noexcept {
+            memory::coroutine_pool().deallocate(ptr, bytes);
+        }
+    };
+
+   private:
+    std::coroutine_handle<promise_type> m_Handle{};
+
+   public:
+    Task() = default;
+    ~Task() noexcept { reset(); }
+
+   public:
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    Task(Task&& other) noexcept : m_Handle(std::exchange(other.m_Handle, {})) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            reset();
+            m_Handle = std::exchange(other.m_Handle, {});
+        }
+        return *this;
+    }
+
+   public:
+    bool valid() const noexcept { return static_cast<bool>(m_Handle); }
+    bool done() const noexcept { return !m_Handle || m_Handle.done(); }
+    std::coroutine_handle<> handle() const noexcept { return m_Handle; }
+
+    void reset() noexcept {
+        if (m_Handle) {
+            m_Handle.destroy();
+            m_Handle = {};
+        }
+    }
+
+   private:
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept : m_Handle(handle) {}
+};
+
+}  // namespace pill_game
@@ -0,0 +1,80 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <string_view>
+
+namespace pill_game {
+
+//
+// Fixed capacity, always null terminated text built with std::to_chars; used
+// for per-frame strings (HUD, overlays) that must not allocate. Anything past
+// the capacity is dropped.
+//
+template <size_t N>
+class TextBuffer {
+    static_assert(N > 1);
+
+   private:
+    std::array<char, N> m_Data{};
+    size_t m_Size{0};
+
+   public:
+    constexpr TextBuffer() noexcept = default;
+
+   public:
+    TextBuffer& operator<<(std::string_view str) noexcept {
+        const size_t count = std::min(str.size(), remaining());
+        std::copy_n(str.data(), count, m_Data.data() + m_Size);
+        m_Size += count;
+        m_Data.at(m_Size) = '\0';
+        return *this;
+    }
+
+    TextBuffer& operator<<(char c) noexcept { return *this << std::string_view{&c, 1}; }
+
+    template <std::integral T>
+    TextBuffer& operator<<(T value) noexcept {
+        return convert([value](char* first, char* last) { return std::to_chars(first, last, value); });
+    }
+
+    TextBuffer& append(float value, int precision) noexcept {
+        return convert([value, precision](char* first, char* last) {
+            return std::to_chars(first, last, value, std::chars_format::fixed, precision);
+        });
+    }
+
+    void clear() noexcept {
+        m_Size = 0;
+        m_Data.at(0) = '\0';
+    }
+
+    std::string_view view() const noexcept { return std::string_view{m_Data.data(), m_Size}; }
+    const char* c_str() const noexcept { return m_Data.data(); }
+    size_t size() const noexcept { return m_Size; }
+
+   private:
+    size_t remaining() const noexcept { return (N - 1) - m_Size; }
+
+    template <class Fn>
+    TextBuffer& convert(Fn&& fn) noexcept {
+        char* first = m_Data.data() + m_Size;
+        const auto [ptr, ec] = fn(first, first + remaining());
+        if (ec == std::errc{}) {
+            m_Size = static_cast<size_t>(ptr - m_Data.data());
+        }
+        m_Data.at(m_Size) = '\0';
+        return *this;
+    }
+};
+
+}  // namespace pill_game
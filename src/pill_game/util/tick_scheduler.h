@@ -0,0 +1,153 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+namespace pill_game {
+
+//
+// Fixed capacity min-heap of events keyed by an integer tick deadline. Each
+// event is scheduled at most once; scheduling it again moves its deadline.
+// Only advance() moves the clock, so a paused owner simply stops calling it.
+//
+// The heap is plain data when Event is, e.g. an enum for state that must be
+// copied or replayed. Events due on the same tick fire in an unspecified but
+// deterministic order.
+//
+template <class Event, size_t Capacity>
+class TickScheduler {
+   private:
+    struct Entry {
+        uint64_t Deadline{0};
+        Event Id{};
+    };
+
+    std::array<Entry, Capacity> m_Heap{};
+    uint32_t m_Size{0};
+    uint64_t m_Now{0};
+
+   public:
+    uint64_t now() const noexcept { return m_Now; }
+    size_t size() const noexcept { return m_Size; }
+    bool empty() const noexcept { return m_Size == 0; }
+
+    // Drops every event and restarts the clock at 'now'
+    void clear(uint64_t now = 0) noexcept {
+        m_Size = 0;
+        m_Now = now;
+    }
+
+    // Returns false only when the event is new and the heap is full
+    bool schedule(Event id, uint64_t deadline) noexcept {
+        if (const auto index = find(id); index.has_value()) {
+            const uint64_t previous = m_Heap.at(*index).Deadline;
+            m_Heap.at(*index).Deadline = deadline;
+            if (deadline < previous) {
+                sift_up(*index);
+            } else {
+                sift_down(*index);
+            }
+            return true;
+        }
+
+        if (m_Size == Capacity) {
+            return false;
+        }
+        m_Heap.at(m_Size) = Entry{deadline, id};
+        sift_up(m_Size++);
+        return true;
+    }
+
+    bool schedule_after(Event id, uint64_t ticks) noexcept { return schedule(id, m_Now + ticks); }
+
+    void cancel(Event id) noexcept {
+        if (const auto index = find(id); index.has_value()) {
+            remove_at(*index);
+        }
+    }
+
+    std::optional<uint64_t> deadline(Event id) const noexcept {
+        if (const auto index = find(id); index.has_value()) {
+            return m_Heap.at(*index).Deadline;
+        }
+        return std::nullopt;
+    }
+
+    bool is_scheduled(Event id) const noexcept { return find(id).has_value(); }
+
+    // Moves the clock to 'now' and hands every event that is due to 'fire' in
+    // deadline order. 'fire' may schedule further events; those due by 'now'
+    // fire during this same call.
+    template <class Fn>
+    void advance(uint64_t now, Fn&& fire) {
+        m_Now = now;
+        while (m_Size > 0 && m_Heap.front().Deadline <= now) {
+            const Event id = m_Heap.front().Id;
+            remove_at(0);
+            fire(id);
+        }
+    }
+
+   private:
+    std::optional<size_t> find(Event id) const noexcept {
+        // capacities are small, a scan beats keeping a separate index
+        for (size_t i = 0; i < m_Size; ++i) {
+            if (m_Heap.at(i).Id == id) {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    void remove_at(size_t index) noexcept {
+        --m_Size;
+        if (index == m_Size) {
+            return;
+        }
+        m_Heap.at(index) = m_Heap.at(m_Size);
+        sift_down(index);
+        sift_up(index);
+    }
+
+    void sift_up(size_t index) noexcept {
+        while (index > 0) {
+            const size_t parent = (index - 1) / 2;
+            if (m_Heap.at(parent).Deadline <= m_Heap.at(index).Deadline) {
+                return;
+            }
+            std::swap(m_Heap.at(parent), m_Heap.at(index));
+            index = parent;
+        }
+    }
+
+    void sift_down(size_t index) noexcept {
+        while (true) {
+            const size_t left = (index * 2) + 1;
+            const size_t right = left + 1;
+            size_t smallest = index;
+
+            if (left < m_Size && m_Heap.at(left).Deadline < m_Heap.at(smallest).Deadline) {
+                smallest = left;
+            }
+            if (right < m_Size && m_Heap.at(right).Deadline < m_Heap.at(smallest).Deadline) {
+                smallest = right;
+            }
+            if (smallest == index) {
+                return;
+            }
+            std::swap(m_Heap.at(index), m_Heap.at(smallest));
+            index = smallest;
+        }
+    }
+};
+
+}  // namespace pill_game
@@ -0,0 +1,60 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace pill_game {
+
+//
+// Lock-free single producer / single consumer hand-off of the latest value.
+// The producer fills back() and publish()es it; the consumer acquire()s the
+// newest published value. Neither side ever waits on the other, and the
+// consumer's value stays untouched until its next acquire().
+//
+template <class T>
+class TripleBuffer {
+   private:
+    static constexpr uint8_t INDEX_MASK = 0b011;
+    static constexpr uint8_t DIRTY_BIT = 0b100;
+
+    std::array<T, 3> m_Slots;
+    alignas(64) std::atomic<uint8_t> m_Shared{1};
+    alignas(64) uint8_t m_Back{0};   // producer only
+    alignas(64) uint8_t m_Front{2};  // consumer only
+
+   public:
+    TripleBuffer() = default;
+
+   public:
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+   public:
+    // Producer
+    T& back() noexcept { return m_Slots.at(m_Back); }
+
+    void publish() noexcept {
+        const uint8_t previous = m_Shared.exchange(m_Back | DIRTY_BIT, std::memory_order_acq_rel);
+        m_Back = previous & INDEX_MASK;
+    }
+
+    // Consumer
+    const T& acquire() noexcept {
+        if ((m_Shared.load(std::memory_order_relaxed) & DIRTY_BIT) != 0) {
+            const uint8_t previous = m_Shared.exchange(m_Front, std::memory_order_acq_rel);
+            m_Front = previous & INDEX_MASK;
+        }
+        return m_Slots.at(m_Front);
+    }
+
+    const T& front() const noexcept { return m_Slots.at(m_Front); }
+};
+
+}  // namespace pill_game
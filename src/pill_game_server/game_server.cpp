@@ -0,0 +1,458 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game_server/game_server.h"
+
+#include "pill_game/game/session_pool.h"
+#include "pill_game/net/protocol.h"
+#include "pill_game/util/spsc_queue.h"
+
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace pill_game::server {
+
+namespace {
+
+using game::SessionId;
+using Clock = std::chrono::steady_clock;
+
+// clang-format off
+constexpr size_t   INCOMING_QUEUE_SIZE = 1024;
+constexpr int      MAX_EPOLL_EVENTS    = 256;
+constexpr uint64_t TAG_TIMER           = std::numeric_limits<uint64_t>::max();
+constexpr uint64_t TAG_WAKE            = TAG_TIMER - 1;
+constexpr uint32_t WORKER_ID_SHIFT     = 24;  // Welcome ids are unique across workers
+constexpr auto     TICK_PERIOD         = std::chrono::nanoseconds{std::chrono::seconds{1}} / game::SIM_TICK_RATE;
+// clang-format on
+
+uint64_t now_ns(void) noexcept {
+    timespec now{};
+    ::clock_gettime(CLOCK_MONOTONIC, &now);
+    return (static_cast<uint64_t>(now.tv_sec) * 1'000'000'000ULL) + static_cast<uint64_t>(now.tv_nsec);
+}
+
+}  // namespace
+
+void ServerStats::merge(const ServerStats& other) noexcept {
+    TickLatency.merge(other.TickLatency);
+    Ticks = std::max(Ticks, other.Ticks);
+    Overruns += other.Overruns;
+    PeakSessions += other.PeakSessions;
+    Rejected += other.Rejected;
+    MessagesSent += other.MessagesSent;
+    BytesSent += other.BytesSent;
+    SendsDeferred += other.SendsDeferred;
+}
+
+//
+// One thread, one epoll instance: the tick timer, a wake eventfd for newly
+// accepted connections, and every connection it owns. Connection slots are
+// reused and their index is the epoll tag, so lookups never hash.
+//
+class ServerWorker {
+   private:
+    struct Connection {
+        UniqueFd Socket{};
+        std::optional<SessionId> Session{};
+        net::BoardMirror LastSent{};
+        bool Resync{false};  // a delta was dropped, the next one carries every cell
+    };
+
+    uint32_t m_Index{0};
+    MatchRule m_Rule{MatchRule::Lines};
+    UniqueFd m_Epoll;
+    UniqueFd m_Timer;
+    UniqueFd m_Wake;
+    SpscQueue<int, INCOMING_QUEUE_SIZE> m_Incoming{};
+    std::atomic<bool> m_Running{false};
+    std::atomic<bool> m_ResetStats{false};
+
+    game::SessionPool m_Pool;
+    std::vector<Connection> m_Connections;
+    std::vector<uint32_t> m_FreeConnections;
+    std::vector<uint32_t> m_Owners;  // session id -> connection slot
+    net::MessageBuffer m_Buffer{};
+
+    uint64_t m_NextDeadlineNs{0};
+    ServerStats m_Stats{};
+    std::thread m_Thread;
+
+   public:
+    ServerWorker(uint32_t index, uint32_t capacity, MatchRule rule)
+        : m_Index(index),
+          m_Rule(rule),
+          m_Epoll(make_epoll()),
+          m_Timer(::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC)),
+          m_Wake(make_eventfd()),
+          m_Pool(capacity),
+          m_Owners(capacity, 0) {
+        if (!m_Timer) {
+            throw_errno("failed to create tick timer");
+        }
+        epoll_add(m_Epoll.get(), m_Timer.get(), EPOLLIN, TAG_TIMER);
+        epoll_add(m_Epoll.get(), m_Wake.get(), EPOLLIN, TAG_WAKE);
+    }
+
+    ~ServerWorker() noexcept { stop(); }
+
+   public:
+    ServerWorker(const ServerWorker&) = delete;
+    ServerWorker& operator=(const ServerWorker&) = delete;
+
+   public:
+    void start() {
+        m_NextDeadlineNs = now_ns() + static_cast<uint64_t>(TICK_PERIOD.count());
+
+        itimerspec timer{};
+        timer.it_value.tv_sec = static_cast<time_t>(m_NextDeadlineNs / 1'000'000'000ULL);
+        timer.it_value.tv_nsec = static_cast<long>(m_NextDeadlineNs % 1'000'000'000ULL);
+        timer.it_interval.tv_nsec = static_cast<long>(TICK_PERIOD.count());
+        if (::timerfd_settime(m_Timer.get(), TFD_TIMER_ABSTIME, &timer, nullptr) != 0) {
+            throw_errno("failed to arm tick timer");
+        }
+
+        m_Running.store(true, std::memory_order_relaxed);
+        m_Thread = std::thread{[this]() { run(); }};
+    }
+
+    void stop() noexcept {
+        m_Running.store(false, std::memory_order_relaxed);
+        notify_eventfd(m_Wake.get());
+        if (m_Thread.joinable()) {
+            m_Thread.join();
+        }
+    }
+
+    // Called from the acceptor thread; takes ownership of 'fd'
+    bool hand_over(int fd) noexcept {
+        if (!m_Incoming.try_push(fd)) {
+            return false;
+        }
+        notify_eventfd(m_Wake.get());
+        return true;
+    }
+
+    void reset_stats() noexcept { m_ResetStats.store(true, std::memory_order_relaxed); }
+    const ServerStats& stats() const noexcept { return m_Stats; }
+
+   private:
+    void run() noexcept {
+        std::array<epoll_event, MAX_EPOLL_EVENTS> events{};
+
+        while (m_Running.load(std::memory_order_relaxed)) {
+            const int count = ::epoll_wait(m_Epoll.get(), events.data(), MAX_EPOLL_EVENTS, -1);
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                PG_LOG(Err, "worker {} epoll_wait failed - {}", m_Index, std::strerror(errno));
+                break;
+            }
+
+            for (int i = 0; i < count; ++i) {
+                const epoll_event& event = events.at(static_cast<size_t>(i));
+                if (event.data.u64 == TAG_TIMER) {
+                    on_timer();
+                } else if (event.data.u64 == TAG_WAKE) {
+                    drain_eventfd(m_Wake.get());
+                    adopt_incoming();
+                } else {
+                    on_readable(static_cast<uint32_t>(event.data.u64), event.events);
+                }
+            }
+        }
+
+        for (uint32_t slot = 0; slot < m_Connections.size(); ++slot) {
+            close_connection(slot);
+        }
+        int fd{-1};
+        while (m_Incoming.try_pop(fd)) {
+            ::close(fd);
+        }
+    }
+
+    void adopt_incoming() noexcept {
+        int fd{-1};
+        while (m_Incoming.try_pop(fd)) {
+            uint32_t slot{0};
+            if (!m_FreeConnections.empty()) {
+                slot = m_FreeConnections.back();
+                m_FreeConnections.pop_back();
+            } else {
+                slot = static_cast<uint32_t>(m_Connections.size());
+                m_Connections.emplace_back();
+            }
+
+            Connection& connection = m_Connections.at(slot);
+            connection = Connection{};
+            connection.Socket.reset(fd);
+
+            try {
+                epoll_add(m_Epoll.get(), fd, EPOLLIN | EPOLLRDHUP, slot);
+            } catch (const std::exception& ex) {
+                PG_LOG(Warn, "worker {} dropped a connection - {}", m_Index, ex.what());
+                close_connection(slot);
+            }
+        }
+    }
+
+    void close_connection(uint32_t slot) noexcept {
+        Connection& connection = m_Connections.at(slot);
+        if (!connection.Socket) {
+            return;
+        }
+        if (connection.Session.has_value()) {
+            m_Pool.destroy(*connection.Session);
+        }
+        ::epoll_ctl(m_Epoll.get(), EPOLL_CTL_DEL, connection.Socket.get(), nullptr);
+        connection = Connection{};
+        m_FreeConnections.push_back(slot);
+    }
+
+    void on_readable(uint32_t slot, uint32_t events) noexcept {
+        Connection& connection = m_Connections.at(slot);
+
+        while (connection.Socket) {
+            const ssize_t got = ::recv(connection.Socket.get(), m_Buffer.data(), m_Buffer.size(), 0);
+            if (got > 0) {
+                on_message(slot, {m_Buffer.data(), static_cast<size_t>(got)});
+                continue;
+            }
+            if (got < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                break;
+            }
+            if (got < 0 && errno == EINTR) {
+                continue;
+            }
+            close_connection(slot);  // orderly shutdown or a hard error
+            return;
+        }
+
+        if ((events & (EPOLLHUP | EPOLLERR)) != 0) {
+            close_connection(slot);
+        }
+    }
+
+    void on_message(uint32_t slot, std::span<const uint8_t> message) noexcept {
+        Connection& connection = m_Connections.at(slot);
+
+        switch (net::message_type(message).value_or(net::MessageType::Reject)) {
+            case net::MessageType::Hello: {
+                const auto hello = net::decode_hello(message);
+                if (!hello.has_value()) {
+                    break;
+                }
+                if (connection.Session.has_value()) {
+                    m_Pool.destroy(*connection.Session);
+                }
+
+                connection.Session = m_Pool.create(
+                    hello->Seed,
+                    hello->Level,
+                    (hello->Flags & net::HELLO_FLAG_PILLS) != 0,
+                    (hello->Flags & net::HELLO_FLAG_BLOCKS) != 0,
+                    m_Rule
+                );
+                connection.LastSent = net::BoardMirror{};
+                connection.Resync = true;
+
+                if (connection.Session.has_value()) {
+                    m_Owners.at(*connection.Session) = slot;
+                    m_Stats.PeakSessions = std::max<uint64_t>(m_Stats.PeakSessions, m_Pool.active_count());
+                    send(slot, net::encode_welcome(m_Buffer, (m_Index << WORKER_ID_SHIFT) | *connection.Session));
+                } else {
+                    ++m_Stats.Rejected;
+                    send(slot, net::encode_reject(m_Buffer));
+                }
+                break;
+            }
+
+            case net::MessageType::Input: {
+                const auto input = net::decode_input(message);
+                if (input.has_value() && connection.Session.has_value()) {
+                    m_Pool.input(*connection.Session).apply(game::InputEvent{0, input->Key, input->Pressed});
+                }
+                break;
+            }
+
+            default:
+                break;  // server bound messages only; anything else is ignored
+        }
+    }
+
+    bool send(uint32_t slot, size_t size) noexcept {
+        Connection& connection = m_Connections.at(slot);
+        const ssize_t sent = ::send(connection.Socket.get(), m_Buffer.data(), size, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (sent == static_cast<ssize_t>(size)) {
+            ++m_Stats.MessagesSent;
+            m_Stats.BytesSent += size;
+            return true;
+        }
+        if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            ++m_Stats.SendsDeferred;
+            connection.Resync = true;
+            return false;
+        }
+        close_connection(slot);
+        return false;
+    }
+
+    void on_timer() noexcept {
+        uint64_t expirations{0};
+        if (::read(m_Timer.get(), &expirations, sizeof(expirations)) != sizeof(expirations) || expirations == 0) {
+            return;
+        }
+
+        if (m_ResetStats.exchange(false, std::memory_order_relaxed)) {
+            m_Stats = ServerStats{};
+            m_Stats.PeakSessions = m_Pool.active_count();
+        }
+
+        // a late wakeup catches up on the simulation but only sends the result
+        for (uint64_t i = 0; i < expirations; ++i) {
+            m_Pool.tick_all();
+        }
+        const uint64_t deadline = m_NextDeadlineNs + ((expirations - 1) * static_cast<uint64_t>(TICK_PERIOD.count()));
+        m_NextDeadlineNs = deadline + static_cast<uint64_t>(TICK_PERIOD.count());
+        m_Stats.Ticks += expirations;
+        m_Stats.Overruns += expirations - 1;
+
+        broadcast();
+
+        const uint64_t finished = now_ns();
+        m_Stats.TickLatency.record(finished > deadline ? finished - deadline : 0);
+    }
+
+    void broadcast() noexcept {
+        for (uint32_t slot = 0; slot < m_Connections.size(); ++slot) {
+            Connection& connection = m_Connections.at(slot);
+            if (!connection.Session.has_value()) {
+                continue;
+            }
+
+            const SessionId id = *connection.Session;
+            const game::GameSession& session = m_Pool.session(id);
+
+            const bool full = std::exchange(connection.Resync, false);
+            const size_t size = net::encode_board_delta(m_Buffer, session, connection.LastSent, full);
+            if (size != 0 && !send(slot, size)) {
+                continue;
+            }
+
+            if (session.Finished) {
+                if (send(slot, net::encode_game_over(m_Buffer, session))) {
+                    m_Pool.destroy(id);
+                    m_Connections.at(slot).Session.reset();
+                }
+            }
+        }
+    }
+};
+
+GameServer::GameServer(ServerSettings settings) : m_Settings(std::move(settings)) {
+}
+
+GameServer::~GameServer() noexcept {
+    stop();
+}
+
+void GameServer::start() {
+    const uint32_t threads = m_Settings.Threads != 0
+                                 ? m_Settings.Threads
+                                 : std::max(1U, std::thread::hardware_concurrency());
+
+    m_Listener = listen_unix(m_Settings.SocketPath, LISTEN_BACKLOG);
+    m_Epoll = make_epoll();
+    m_Stop = make_eventfd();
+    epoll_add(m_Epoll.get(), m_Listener.get(), EPOLLIN, 0);
+    epoll_add(m_Epoll.get(), m_Stop.get(), EPOLLIN, 1);
+
+    m_Workers.reserve(threads);
+    for (uint32_t i = 0; i < threads; ++i) {
+        m_Workers.push_back(std::make_unique<ServerWorker>(i, m_Settings.SessionsPerWorker, m_Settings.Rule));
+        m_Workers.back()->start();
+    }
+
+    m_Acceptor = std::thread{[this]() { accept_loop(); }};
+    PG_LOG(Info, "serving on {} with {} workers", m_Settings.SocketPath.string(), threads);
+}
+
+void GameServer::stop() noexcept {
+    if (m_Acceptor.joinable()) {
+        notify_eventfd(m_Stop.get());
+        m_Acceptor.join();
+    }
+    for (auto& worker : m_Workers) {
+        worker->stop();
+    }
+
+    if (m_Listener) {
+        m_Listener.reset();
+        std::error_code ec{};
+        fs::remove(m_Settings.SocketPath, ec);
+    }
+}
+
+void GameServer::reset_stats() noexcept {
+    for (auto& worker : m_Workers) {
+        worker->reset_stats();
+    }
+}
+
+ServerStats GameServer::stats() const noexcept {
+    ServerStats total{};
+    for (const auto& worker : m_Workers) {
+        total.merge(worker->stats());
+    }
+    return total;
+}
+
+void GameServer::accept_loop() noexcept {
+    std::array<epoll_event, 2> events{};
+
+    while (true) {
+        const int count = ::epoll_wait(m_Epoll.get(), events.data(), static_cast<int>(events.size()), -1);
+        if (count < 0 && errno != EINTR) {
+            PG_LOG(Err, "acceptor epoll_wait failed - {}", std::strerror(errno));
+            return;
+        }
+
+        for (int i = 0; i < count; ++i) {
+            if (events.at(static_cast<size_t>(i)).data.u64 == 1) {
+                return;
+            }
+            accept_pending();
+        }
+    }
+}
+
+void GameServer::accept_pending() noexcept {
+    while (true) {
+        const int fd = ::accept4(m_Listener.get(), nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                PG_LOG(Warn, "accept failed - {}", std::strerror(errno));
+            }
+            if (errno != EINTR) {
+                return;
+            }
+            continue;
+        }
+
+        ServerWorker& worker = *m_Workers.at(m_NextWorker);
+        m_NextWorker = (m_NextWorker + 1) % m_Workers.size();
+        if (!worker.hand_over(fd)) {
+            PG_LOG(Warn, "worker backlog is full, dropping a connection");
+            ::close(fd);
+        }
+    }
+}
+
+}  // namespace pill_game::server
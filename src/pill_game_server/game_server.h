@@ -0,0 +1,88 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+#include "pill_game/game/match_rules.h"
+#include "pill_game/util/latency_histogram.h"
+#include "pill_game_server/socket.h"
+
+namespace pill_game::server {
+
+// clang-format off
+constexpr uint32_t DEFAULT_SESSIONS_PER_WORKER = 8192;
+constexpr int      LISTEN_BACKLOG              = 4096;
+// clang-format on
+
+struct ServerSettings {
+    fs::path SocketPath{"pill_game.sock"};
+    uint32_t Threads{0};  // 0 = one worker per hardware thread
+    uint32_t SessionsPerWorker{DEFAULT_SESSIONS_PER_WORKER};
+    MatchRule Rule{MatchRule::Lines};  // for every session this server starts
+};
+
+struct ServerStats {
+    LatencyHistogram TickLatency{};  // tick deadline -> every delta for it sent
+    uint64_t Ticks{0};
+    uint64_t Overruns{0};      // deadlines missed because the previous tick ran long
+    uint64_t PeakSessions{0};
+    uint64_t Rejected{0};      // Hello refused, worker full
+    uint64_t MessagesSent{0};
+    uint64_t BytesSent{0};
+    uint64_t SendsDeferred{0};  // socket full; the client gets a full board next tick
+
+    void merge(const ServerStats& other) noexcept;
+};
+
+class ServerWorker;
+
+//
+// Headless, authoritative host for many sessions. One acceptor thread takes
+// connections from a Unix domain socket and deals them out round robin to
+// worker threads; each worker owns its connections and a SessionPool and
+// drives both from one epoll loop, ticking every session at SIM_TICK_RATE
+// and sending each client the board cells that changed.
+//
+class GameServer {
+   private:
+    ServerSettings m_Settings;
+    UniqueFd m_Listener;
+    UniqueFd m_Epoll;
+    UniqueFd m_Stop;
+    std::vector<std::unique_ptr<ServerWorker>> m_Workers;
+    std::thread m_Acceptor;
+    size_t m_NextWorker{0};
+
+   public:
+    explicit GameServer(ServerSettings settings);
+    ~GameServer() noexcept;
+
+   public:
+    GameServer(const GameServer&) = delete;
+    GameServer& operator=(const GameServer&) = delete;
+
+   public:
+    // Binds the socket and starts every thread; throws on failure
+    void start();
+    void stop() noexcept;
+
+    // Workers drop what they have measured so far at their next tick
+    void reset_stats() noexcept;
+
+    // Merged over every worker; only meaningful once stopped
+    ServerStats stats() const noexcept;
+
+    const fs::path& socket_path() const noexcept { return m_Settings.SocketPath; }
+    size_t worker_count() const noexcept { return m_Workers.size(); }
+
+   private:
+    void accept_loop() noexcept;
+    void accept_pending() noexcept;
+};
+
+}  // namespace pill_game::server
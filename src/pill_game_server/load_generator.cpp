@@ -0,0 +1,287 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game_server/load_generator.h"
+
+#include "pill_game/bench/bot_input.h"
+#include "pill_game/net/protocol.h"
+#include "pill_game_server/game_server.h"
+
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace pill_game::server {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// clang-format off
+constexpr uint32_t DEFAULT_SIZES[]     = {1000, 10000};
+constexpr auto     INPUT_PERIOD        = std::chrono::nanoseconds{std::chrono::seconds{1}} / game::SIM_TICK_RATE;
+constexpr auto     BUILD_TIME          = INPUT_PERIOD * static_cast<int64_t>(GAME_BOARD_SIZE * game::BUILD_STEP_TICKS);
+constexpr auto     WARM_UP             = BUILD_TIME + std::chrono::seconds{1};  // first boards built, then settle
+constexpr int      MAX_EPOLL_EVENTS    = 256;
+constexpr int      FDS_PER_CLIENT      = 2;   // both ends live in this process
+constexpr uint32_t FD_HEADROOM         = 64;
+constexpr uint8_t  MAX_LEVEL           = 20;
+// clang-format on
+
+struct Bot {
+    UniqueFd Socket{};
+    net::BoardMirror Mirror{};
+    uint32_t Rng{0};
+    bool Playing{false};
+};
+
+struct ClientStats {
+    uint64_t MessagesReceived{0};
+    uint64_t BytesReceived{0};
+    uint64_t InputsSent{0};
+    uint64_t GamesFinished{0};
+    uint64_t Rejected{0};
+    uint64_t BadMessages{0};
+
+    void merge(const ClientStats& other) noexcept {
+        MessagesReceived += other.MessagesReceived;
+        BytesReceived += other.BytesReceived;
+        InputsSent += other.InputsSent;
+        GamesFinished += other.GamesFinished;
+        Rejected += other.Rejected;
+        BadMessages += other.BadMessages;
+    }
+};
+
+void send_message(Bot& bot, const net::MessageBuffer& buffer, size_t size) noexcept {
+    // a full socket just loses the message; the bot presses something else later
+    [[maybe_unused]] const auto sent = ::send(bot.Socket.get(), buffer.data(), size, MSG_DONTWAIT | MSG_NOSIGNAL);
+}
+
+void send_hello(Bot& bot, net::MessageBuffer& buffer) noexcept {
+    const uint32_t r = bench::xorshift(bot.Rng);
+    const net::HelloMessage hello{
+        .Seed = r,
+        .Level = static_cast<uint8_t>(1 + (r % MAX_LEVEL)),
+        .Flags = static_cast<uint8_t>(net::HELLO_FLAG_PILLS | (((r >> 8U) & 1U) != 0 ? net::HELLO_FLAG_BLOCKS : 0)),
+    };
+    bot.Mirror = net::BoardMirror{};
+    bot.Playing = false;
+    send_message(bot, buffer, net::encode_hello(buffer, hello));
+}
+
+//
+// Drives a share of the bots from one epoll loop: reads whatever the server
+// sent and, once per tick, gives each playing bot a chance to press or
+// release one of the gameplay buttons.
+//
+class ClientThread {
+   private:
+    std::vector<Bot> m_Bots;
+    UniqueFd m_Epoll;
+    net::MessageBuffer m_Buffer{};
+    ClientStats m_Stats{};
+    std::atomic<bool> m_ResetStats{false};
+
+   public:
+    ClientThread(const fs::path& socket_path, uint32_t bot_count, uint32_t first_seed)
+        : m_Bots(bot_count),
+          m_Epoll(make_epoll()) {
+        for (uint32_t i = 0; i < bot_count; ++i) {
+            Bot& bot = m_Bots.at(i);
+            bot.Socket = connect_unix(socket_path);
+            bot.Rng = (first_seed + i + 1) * 2654435761U;
+            epoll_add(m_Epoll.get(), bot.Socket.get(), EPOLLIN, i);
+            send_hello(bot, m_Buffer);
+        }
+    }
+
+   public:
+    void run(const std::atomic<bool>& running) noexcept {
+        std::array<epoll_event, MAX_EPOLL_EVENTS> events{};
+        auto next_input = Clock::now() + INPUT_PERIOD;
+
+        while (running.load(std::memory_order_relaxed)) {
+            if (m_ResetStats.exchange(false, std::memory_order_relaxed)) {
+                m_Stats = ClientStats{};
+            }
+
+            const auto wait = std::chrono::ceil<std::chrono::milliseconds>(next_input - Clock::now());
+            const int count = ::epoll_wait(
+                m_Epoll.get(),
+                events.data(),
+                MAX_EPOLL_EVENTS,
+                static_cast<int>(std::max<int64_t>(0, wait.count()))
+            );
+
+            for (int i = 0; i < count; ++i) {
+                receive(m_Bots.at(events.at(static_cast<size_t>(i)).data.u64));
+            }
+
+            if (Clock::now() >= next_input) {
+                press_buttons();
+                next_input += INPUT_PERIOD;
+            }
+        }
+    }
+
+    // Picked up by run() on its next pass; the warm up doesn't count
+    void reset_stats() noexcept { m_ResetStats.store(true, std::memory_order_relaxed); }
+
+    // Only once run() has returned
+    const ClientStats& stats() const noexcept { return m_Stats; }
+
+   private:
+    void receive(Bot& bot) noexcept {
+        while (true) {
+            const ssize_t got = ::recv(bot.Socket.get(), m_Buffer.data(), m_Buffer.size(), MSG_DONTWAIT);
+            if (got <= 0) {
+                return;
+            }
+
+            const std::span<const uint8_t> message{m_Buffer.data(), static_cast<size_t>(got)};
+            ++m_Stats.MessagesReceived;
+            m_Stats.BytesReceived += message.size();
+
+            switch (net::message_type(message).value_or(net::MessageType::Hello)) {
+                case net::MessageType::Welcome:
+                    bot.Playing = true;
+                    break;
+                case net::MessageType::BoardDelta:
+                    if (!net::apply_board_delta(message, bot.Mirror)) {
+                        ++m_Stats.BadMessages;
+                    }
+                    break;
+                case net::MessageType::GameOver:
+                    ++m_Stats.GamesFinished;
+                    send_hello(bot, m_Buffer);
+                    break;
+                case net::MessageType::Reject:
+                    ++m_Stats.Rejected;
+                    bot.Playing = false;
+                    break;
+                default:
+                    ++m_Stats.BadMessages;
+                    break;
+            }
+        }
+    }
+
+    void press_buttons() noexcept {
+        for (Bot& bot : m_Bots) {
+            const auto event = bench::bot_input(bot.Rng);
+            if (!bot.Playing || !event) {
+                continue;
+            }
+            const net::InputMessage input{
+                .Key = event->Key,
+                .Pressed = event->Pressed,
+            };
+            send_message(bot, m_Buffer, net::encode_input(m_Buffer, input));
+            ++m_Stats.InputsSent;
+        }
+    }
+};
+
+double to_us(uint64_t ns) noexcept {
+    return static_cast<double>(ns) / 1000.0;
+}
+
+uint32_t fd_limit(void) noexcept {
+    rlimit limit{};
+    if (::getrlimit(RLIMIT_NOFILE, &limit) != 0 || limit.rlim_cur == RLIM_INFINITY) {
+        return std::numeric_limits<uint32_t>::max();
+    }
+    return static_cast<uint32_t>(std::min<rlim_t>(limit.rlim_cur, std::numeric_limits<uint32_t>::max()));
+}
+
+int run_one(uint32_t clients, uint32_t seconds, uint32_t threads, MatchRule rule) {
+    const uint32_t max_clients = fd_limit() > FD_HEADROOM ? (fd_limit() - FD_HEADROOM) / FDS_PER_CLIENT : 0;
+    if (clients > max_clients) {
+        PG_LOG(Warn, "open file limit allows {} clients, not {}", max_clients, clients);
+        clients = max_clients;
+    }
+
+    const uint32_t hardware = std::max(1U, std::thread::hardware_concurrency());
+    const uint32_t server_threads = threads != 0 ? threads : std::max(1U, hardware / 2);
+    const uint32_t client_threads = server_threads < hardware ? hardware - server_threads : 1U;
+
+    ServerSettings settings{};
+    settings.SocketPath = fs::temp_directory_path() / std::format("pill_game_load_{}.sock", ::getpid());
+    settings.Threads = server_threads;
+    settings.SessionsPerWorker = (clients / server_threads) + 1;
+    settings.Rule = rule;
+
+    GameServer server{settings};
+    server.start();
+
+    std::vector<std::unique_ptr<ClientThread>> connections{};
+    for (uint32_t i = 0; i < client_threads; ++i) {
+        const uint32_t first = (clients * i) / client_threads;
+        const uint32_t last = (clients * (i + 1)) / client_threads;
+        connections.push_back(std::make_unique<ClientThread>(settings.SocketPath, last - first, first));
+    }
+
+    std::atomic<bool> running{true};
+    std::vector<std::jthread> workers{};
+    for (auto& connection : connections) {
+        workers.emplace_back([&running, &connection]() { connection->run(running); });
+    }
+
+    std::this_thread::sleep_for(WARM_UP);
+    server.reset_stats();
+    for (auto& connection : connections) {
+        connection->reset_stats();
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds{seconds});
+    running.store(false, std::memory_order_relaxed);
+    workers.clear();
+    server.stop();
+
+    ClientStats received{};
+    for (auto& connection : connections) {
+        received.merge(connection->stats());
+    }
+    const ServerStats stats = server.stats();
+    const auto secs = static_cast<double>(seconds);
+    const LatencyHistogram& latency = stats.TickLatency;
+
+    PG_LOG(Info, "sessions      : {} ({} server, {} client threads)", stats.PeakSessions, server_threads, client_threads);
+    PG_LOG(Info, "tick latency  : p50 {:.1f} us, p90 {:.1f} us, p99 {:.1f} us, p99.9 {:.1f} us, max {:.1f} us", to_us(latency.percentile(50.0)), to_us(latency.percentile(90.0)), to_us(latency.percentile(99.0)), to_us(latency.percentile(99.9)), to_us(latency.max()));
+    PG_LOG(Info, "ticks         : {} per worker, {} overruns", stats.Ticks, stats.Overruns);
+    PG_LOG(Info, "server sent   : {:.0f} msg/s, {:.2f} MiB/s, {} deferred", static_cast<double>(stats.MessagesSent) / secs, static_cast<double>(stats.BytesSent) / (secs * 1024.0 * 1024.0), stats.SendsDeferred);
+    PG_LOG(Info, "clients       : {:.0f} msg/s in, {:.0f} inputs/s out, {} games, {} rejected, {} bad", static_cast<double>(received.MessagesReceived) / secs, static_cast<double>(received.InputsSent) / secs, received.GamesFinished, received.Rejected, received.BadMessages);
+
+    return received.BadMessages == 0 ? 0 : -1;
+}
+
+}  // namespace
+
+int run_load_test(uint32_t clients, uint32_t seconds, uint32_t threads, MatchRule rule) noexcept {
+    try {
+        raise_fd_limit();
+        seconds = std::max(1U, seconds);
+
+        if (clients != 0) {
+            return run_one(clients, seconds, threads, rule);
+        }
+
+        int result{0};
+        for (const uint32_t size : DEFAULT_SIZES) {
+            result = std::min(result, run_one(size, seconds, threads, rule));
+        }
+        return result;
+
+    } catch (const std::exception& ex) {
+        PG_LOG(Err, "load test failed - {}", ex.what());
+        return -1;
+    }
+}
+
+}  // namespace pill_game::server
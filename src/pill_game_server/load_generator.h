@@ -0,0 +1,27 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+#include "pill_game/game/match_rules.h"
+
+namespace pill_game::server {
+
+//
+// Starts a GameServer in process and connects 'clients' bot clients to it
+// over its Unix socket, spread over 'threads' client threads. Every bot plays
+// real games (random button edges, a new Hello after each GameOver) and
+// mirrors its board from the deltas it receives. The first boards take
+// a few seconds to build and send nothing, so measuring only starts a second
+// after they're done; the server's tick latency is then measured for
+// 'seconds' and reported as percentiles. A 'clients' of 0 runs 1k and then
+// 10k sessions. Every session plays by 'rule'.
+//
+int run_load_test(uint32_t clients, uint32_t seconds, uint32_t threads, MatchRule rule) noexcept;
+
+}  // namespace pill_game::server
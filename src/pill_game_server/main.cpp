@@ -0,0 +1,101 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+
+#include "pill_game/game/level_corpus.h"
+#include "pill_game_server/game_server.h"
+#include "pill_game_server/load_generator.h"
+
+#include <csignal>
+
+using namespace pill_game;
+
+namespace {
+
+// clang-format off
+constexpr uint32_t DEFAULT_LOAD_SECONDS = 5;
+// clang-format on
+
+uint32_t parse_u32(std::string_view str, uint32_t fallback) noexcept {
+    uint32_t value{fallback};
+    std::from_chars(str.data(), str.data() + str.size(), value);
+    return value;
+}
+
+int run_server(const fs::path& socket_path, uint32_t threads, MatchRule rule) noexcept {
+    // block the signals everywhere and wait for them here, so no worker is interrupted
+    sigset_t signals{};
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    try {
+        server::ServerSettings settings{};
+        settings.SocketPath = socket_path;
+        settings.Threads = threads;
+        settings.Rule = rule;
+
+        server::GameServer game_server{settings};
+        server::raise_fd_limit();
+        game_server.start();
+
+        int signal{0};
+        sigwait(&signals, &signal);
+        PG_LOG(Info, "shutting down");
+        game_server.stop();
+        return 0;
+
+    } catch (const std::exception& ex) {
+        PG_LOG(Err, "server failed - {}", ex.what());
+        return -1;
+    }
+}
+
+}  // namespace
+
+//
+// pill_game_server [socket_path] [threads]            ; serve until SIGINT/SIGTERM
+// pill_game_server --load [clients] [seconds] [threads] ; in process load test, measured once the boards are built
+// pill_game_server --corpus <file> ...                  ; boards come from a level corpus
+// pill_game_server --rules <lines|clusters|shapes> ...  ; what breaks, lines by default
+//
+int main(int argc, char** argv) {
+    std::vector<std::string_view> args(argv, argv + argc);
+
+    std::optional<game::LevelCorpus> corpus{};
+    if (args.size() >= 3 && args.at(1) == "--corpus") {
+        try {
+            corpus.emplace(args.at(2));
+        } catch (const std::exception& ex) {
+            PG_LOG(Err, "{}", ex.what());
+            return -1;
+        }
+        game::set_level_corpus(&*corpus);
+        args.erase(args.begin() + 1, args.begin() + 3);
+    }
+
+    MatchRule rule{MatchRule::Lines};
+    if (args.size() >= 3 && args.at(1) == "--rules") {
+        if (!parse_match_rule(args.at(2), rule)) {
+            PG_LOG(Err, "unknown match rule - {}", args.at(2));
+            return -1;
+        }
+        args.erase(args.begin() + 1, args.begin() + 3);
+    }
+
+    if (args.size() >= 2 && args.at(1) == "--load") {
+        const uint32_t clients = args.size() >= 3 ? parse_u32(args.at(2), 0) : 0;
+        const uint32_t seconds = args.size() >= 4 ? parse_u32(args.at(3), DEFAULT_LOAD_SECONDS) : DEFAULT_LOAD_SECONDS;
+        const uint32_t threads = args.size() >= 5 ? parse_u32(args.at(4), 0) : 0;
+        return server::run_load_test(clients, seconds, threads, rule);
+    }
+
+    const fs::path socket_path = args.size() >= 2 ? fs::path{args.at(1)} : fs::path{"pill_game.sock"};
+    const uint32_t threads = args.size() >= 3 ? parse_u32(args.at(2), 0) : 0;
+    return run_server(socket_path, threads, rule);
+}
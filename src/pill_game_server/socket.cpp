@@ -0,0 +1,134 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#include "pill_game/pch.h"
+#include "pill_game_server/socket.h"
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace pill_game::server {
+
+namespace {
+
+sockaddr_un unix_address(const fs::path& path) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+
+    const std::string str = path.string();
+    if (str.size() >= sizeof(address.sun_path)) {
+        throw std::runtime_error{std::format("socket path is too long - {}", str)};
+    }
+    std::memcpy(address.sun_path, str.c_str(), str.size() + 1);
+    return address;
+}
+
+}  // namespace
+
+void UniqueFd::reset(int fd) noexcept {
+    if (m_Fd >= 0) {
+        ::close(m_Fd);
+    }
+    m_Fd = fd;
+}
+
+void throw_errno(std::string_view what) {
+    throw std::runtime_error{std::format("{} - {}", what, std::strerror(errno))};
+}
+
+UniqueFd listen_unix(const fs::path& path, int backlog) {
+    const sockaddr_un address = unix_address(path);
+
+    UniqueFd fd{::socket(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)};
+    if (!fd) {
+        throw_errno("failed to create socket");
+    }
+
+    std::error_code ec{};
+    fs::remove(path, ec);
+
+    if (::bind(fd.get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        throw_errno(std::format("failed to bind {}", path.string()));
+    }
+    if (::listen(fd.get(), backlog) != 0) {
+        throw_errno(std::format("failed to listen on {}", path.string()));
+    }
+    return fd;
+}
+
+UniqueFd connect_unix(const fs::path& path) {
+    const sockaddr_un address = unix_address(path);
+
+    UniqueFd fd{::socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0)};
+    if (!fd) {
+        throw_errno("failed to create socket");
+    }
+    if (::connect(fd.get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        throw_errno(std::format("failed to connect to {}", path.string()));
+    }
+
+    set_nonblocking(fd.get());
+    return fd;
+}
+
+void set_nonblocking(int fd) {
+    const int flags = ::fcntl(fd, F_GETFL, 0);
+    if (flags < 0 || ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) != 0) {
+        throw_errno("failed to make socket non-blocking");
+    }
+}
+
+UniqueFd make_epoll(void) {
+    UniqueFd fd{::epoll_create1(EPOLL_CLOEXEC)};
+    if (!fd) {
+        throw_errno("failed to create epoll instance");
+    }
+    return fd;
+}
+
+UniqueFd make_eventfd(void) {
+    UniqueFd fd{::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)};
+    if (!fd) {
+        throw_errno("failed to create eventfd");
+    }
+    return fd;
+}
+
+void epoll_add(int epoll_fd, int fd, uint32_t events, uint64_t data) {
+    epoll_event event{};
+    event.events = events;
+    event.data.u64 = data;
+    if (::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0) {
+        throw_errno("failed to add to epoll");
+    }
+}
+
+void notify_eventfd(int fd) noexcept {
+    const uint64_t one{1};
+    [[maybe_unused]] const auto written = ::write(fd, &one, sizeof(one));
+}
+
+void drain_eventfd(int fd) noexcept {
+    uint64_t value{0};
+    [[maybe_unused]] const auto read = ::read(fd, &value, sizeof(value));
+}
+
+void raise_fd_limit(void) noexcept {
+    rlimit limit{};
+    if (::getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        if (::setrlimit(RLIMIT_NOFILE, &limit) != 0) {
+            PG_LOG(Warn, "failed to raise the open file limit - {}", std::strerror(errno));
+        }
+    }
+}
+
+}  // namespace pill_game::server
@@ -0,0 +1,62 @@
+//
+// Date       : 18/10/2026
+// Project    : pill_game
+// Author     : -Ry
+//
+
+#pragma once
+
+#include "pill_game/pch.h"
+
+namespace pill_game::server {
+
+// Owns a file descriptor and closes it on destruction
+class UniqueFd {
+   private:
+    int m_Fd{-1};
+
+   public:
+    UniqueFd() = default;
+    explicit UniqueFd(int fd) noexcept : m_Fd(fd) {}
+    ~UniqueFd() noexcept { reset(); }
+
+   public:
+    UniqueFd(const UniqueFd&) = delete;
+    UniqueFd& operator=(const UniqueFd&) = delete;
+    UniqueFd(UniqueFd&& other) noexcept : m_Fd(std::exchange(other.m_Fd, -1)) {}
+    UniqueFd& operator=(UniqueFd&& other) noexcept {
+        if (this != &other) {
+            reset(std::exchange(other.m_Fd, -1));
+        }
+        return *this;
+    }
+
+   public:
+    int get() const noexcept { return m_Fd; }
+    int release() noexcept { return std::exchange(m_Fd, -1); }
+    void reset(int fd = -1) noexcept;
+    explicit operator bool() const noexcept { return m_Fd >= 0; }
+};
+
+// Throws std::runtime_error naming 'what' and errno
+[[noreturn]] void throw_errno(std::string_view what);
+
+// Non-blocking SOCK_SEQPACKET listener; replaces a stale socket file at 'path'
+UniqueFd listen_unix(const fs::path& path, int backlog);
+
+// Blocking connect, then switched to non-blocking
+UniqueFd connect_unix(const fs::path& path);
+
+void set_nonblocking(int fd);
+UniqueFd make_epoll(void);
+UniqueFd make_eventfd(void);
+void epoll_add(int epoll_fd, int fd, uint32_t events, uint64_t data);
+
+// Wakes whoever waits on an eventfd
+void notify_eventfd(int fd) noexcept;
+void drain_eventfd(int fd) noexcept;
+
+// Lifts the soft open file limit to the hard one; 10k sessions need 10k+ fds
+void raise_fd_limit(void) noexcept;
+
+}  // namespace pill_game::server